@@ -0,0 +1,109 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cstdint>
+#include <random>
+
+#include <lexy/action/parse.hpp>
+#include <lexy/callback.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/buffer.hpp>
+
+namespace
+{
+// A columnar file: each column is a 32-bit length followed by that many 32-bit integers.
+lexy::buffer<lexy::byte_encoding> get_columns(std::size_t size, bool big_endian)
+{
+    constexpr std::uint32_t column_length = 4096;
+
+    std::mt19937                                 engine(42);
+    std::uniform_int_distribution<std::uint32_t> dist;
+
+    lexy::buffer<lexy::byte_encoding>::builder builder(size);
+    auto                                       ptr = builder.data();
+    auto                                       end = ptr + size;
+
+    auto write = [&](std::uint32_t value) {
+        for (auto i = 0u; i != 4; ++i)
+        {
+            auto shift = big_endian ? 24 - 8 * i : 8 * i;
+            *ptr++     = static_cast<unsigned char>(value >> shift);
+        }
+    };
+    while (end - ptr >= 4 * (column_length + 1))
+    {
+        write(column_length);
+        for (auto i = 0u; i != column_length; ++i)
+            write(dist(engine));
+    }
+    // Fill the rest with an empty column each.
+    while (ptr != end)
+        write(0);
+
+    return LEXY_MOV(builder).finish();
+}
+
+namespace grammar
+{
+    namespace dsl = lexy::dsl;
+
+    constexpr auto sum
+        = lexy::fold_inplace<std::uint64_t>(0, [](std::uint64_t& sum, std::uint32_t value) {
+              sum += value;
+          });
+
+    template <typename Bint>
+    struct column_loop
+    {
+        static constexpr auto rule  = dsl::repeat(Bint{}).list(Bint{});
+        static constexpr auto value = sum;
+    };
+
+    template <typename Bint>
+    struct column_array
+    {
+        static constexpr auto rule  = Bint{}.array(Bint{});
+        static constexpr auto value = sum;
+    };
+
+    template <typename Column>
+    struct columns
+    {
+        static constexpr auto rule  = dsl::terminator(dsl::eof).list(dsl::p<Column>);
+        static constexpr auto value = lexy::fold_inplace<std::uint64_t>(
+            0, [](std::uint64_t& sum, std::uint64_t value) { sum += value; });
+    };
+} // namespace grammar
+
+template <typename Column>
+std::uint64_t bm_lexy(const lexy::buffer<lexy::byte_encoding>& data)
+{
+    return lexy::parse<grammar::columns<Column>>(data, lexy::noop).value();
+}
+} // namespace
+
+int main()
+{
+    namespace dsl = lexy::dsl;
+    using big     = LEXY_DECAY_DECLTYPE(dsl::big_bint32);
+    using little  = LEXY_DECAY_DECLTYPE(dsl::little_bint32);
+
+    ankerl::nanobench::Bench b;
+    b.relative(true);
+
+    auto big_data = get_columns(100 * 1024 * 1024, true);
+    b.title("big endian").unit("byte").batch(big_data.size());
+    b.run("repeat().list(big_bint32)",
+          [&] { return bm_lexy<grammar::column_loop<big>>(big_data); });
+    b.run("big_bint32.array()", [&] { return bm_lexy<grammar::column_array<big>>(big_data); });
+
+    auto little_data = get_columns(100 * 1024 * 1024, false);
+    b.title("little endian").unit("byte").batch(little_data.size());
+    b.run("repeat().list(little_bint32)",
+          [&] { return bm_lexy<grammar::column_loop<little>>(little_data); });
+    b.run("little_bint32.array()",
+          [&] { return bm_lexy<grammar::column_array<little>>(little_data); });
+}
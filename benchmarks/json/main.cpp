@@ -82,6 +82,7 @@ const char* output_suffix()
 `lexy`::
     A JSON validator using the lexy grammar from the example.
     It uses the regular `lexy::buffer` as input, enabling SWAR and other optimizations.
+    In particular, string literals are scanned eight bytes at a time until the next quote, backslash, or control character.
     For maximum performance, this is the recommended input.
 `lexy (no SWAR)`::
     Same as above, but it uses a special input where SWAR optimization has been manually disabled.
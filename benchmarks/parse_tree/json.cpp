@@ -0,0 +1,25 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define LEXY_TEST
+#include "../../examples/json.cpp"
+
+#include "parse_tree.hpp"
+#include <lexy/action/parse_as_tree.hpp>
+#include <lexy/action/tokenize.hpp>
+#include <stdexcept>
+
+parse_tree json_tree(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    parse_tree tree;
+    if (!lexy::parse_as_tree<grammar::json>(tree, input, lexy::noop))
+        throw std::runtime_error("invalid JSON");
+    return tree;
+}
+
+std::size_t json_tokenize(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    std::size_t count = 0;
+    lexy::tokenize<grammar::json>(input, [&](auto, std::size_t size) { count += size; });
+    return count;
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include "parse_tree.hpp"
+#include <lexy/input/file.hpp>
+#include <lexy_ext/parallel_visit.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+lexy::buffer<lexy::utf8_encoding> get_json_data(const char* file_name)
+{
+    auto path   = std::string(LEXY_BENCHMARK_DATA) + "/" + file_name;
+    auto result = lexy::read_file<lexy::utf8_encoding>(path.c_str());
+    if (!result)
+        throw std::runtime_error("unable to read data file");
+    return LEXY_MOV(result).buffer();
+}
+
+lexy::buffer<lexy::utf8_encoding> get_xml_data(std::size_t element_count)
+{
+    std::string str = "<catalog>\n";
+    for (auto i = std::size_t(0); i != element_count; ++i)
+    {
+        str += "  <book>\n";
+        str += "    <title>Book &amp; Title " + std::to_string(i) + "</title>\n";
+        str += "    <author>Someone</author><!-- comment -->\n";
+        str += "    <summary><![CDATA[Some <b>long</b> text.]]></summary>\n";
+        str += "  </book>\n";
+    }
+    str += "</catalog>\n";
+    return lexy::buffer<lexy::utf8_encoding>(str.data(), str.size());
+}
+
+// The "analysis" we're doing on each partition: look at all tokens.
+std::size_t visit_partition(const parse_tree& tree, parse_tree::node node)
+{
+    std::size_t result = 0;
+    for (auto [event, n] : tree.traverse(node))
+        if (n.kind().is_token())
+            for (auto c : n.lexeme())
+                result += static_cast<unsigned char>(c);
+    return result;
+}
+
+void bench_tree(ankerl::nanobench::Bench& b, const char* title, const parse_tree& tree)
+{
+    // We partition the tree at the outermost productions that are small enough,
+    // so we get plenty of partitions without making them too tiny.
+    auto max_size  = tree.root().covering_lexeme().size() / 1024;
+    auto predicate = [&](parse_tree::node node) {
+        return node.kind().is_production() && node.covering_lexeme().size() <= max_size;
+    };
+
+    b.title(title).relative(true);
+    b.unit("byte").batch(tree.root().covering_lexeme().size());
+
+    b.run("traverse", [&] { return visit_partition(tree, tree.root()); });
+    b.run("parallel_visit (sequential)", [&] {
+        std::atomic<std::size_t> result(0);
+        lexy_ext::parallel_visit(
+            tree, predicate, [&](parse_tree::node node) { result += visit_partition(tree, node); },
+            lexy_ext::sequential_executor{});
+        return result.load();
+    });
+    for (auto thread_count : {1u, 2u, 4u, 8u})
+    {
+        auto name = "parallel_visit (" + std::to_string(thread_count) + " threads)";
+        b.run(name, [&] {
+            std::atomic<std::size_t> result(0);
+            lexy_ext::parallel_visit(
+                tree, predicate,
+                [&](parse_tree::node node) { result += visit_partition(tree, node); },
+                lexy_ext::thread_executor(thread_count));
+            return result.load();
+        });
+    }
+}
+} // namespace
+
+int main()
+{
+    ankerl::nanobench::Bench b;
+
+    for (auto file : {"canada.json", "citm_catalog.json", "twitter.json"})
+    {
+        auto data = get_json_data(file);
+
+        // Compare the cost of tree construction with just tokenizing.
+        b.title(file).relative(true);
+        b.unit("byte").batch(data.size());
+        b.run("parse_as_tree", [&] { return json_tree(data).size(); });
+        b.run("tokenize", [&] { return json_tokenize(data); });
+
+        auto tree = json_tree(data);
+        bench_tree(b, file, tree);
+    }
+
+    auto xml_data = get_xml_data(20'000);
+    auto xml_tree = ::xml_tree(xml_data);
+    bench_tree(b, "catalog.xml", xml_tree);
+}
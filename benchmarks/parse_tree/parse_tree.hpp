@@ -0,0 +1,19 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_BENCHMARK_PARSE_TREE_HPP_INCLUDED
+#define LEXY_BENCHMARK_PARSE_TREE_HPP_INCLUDED
+
+#include <lexy/input/buffer.hpp>
+#include <lexy/parse_tree.hpp>
+
+using parse_tree = lexy::parse_tree_for<lexy::buffer<lexy::utf8_encoding>>;
+
+// Parse trees using the grammars of the examples.
+parse_tree json_tree(const lexy::buffer<lexy::utf8_encoding>& input);
+parse_tree xml_tree(const lexy::buffer<lexy::utf8_encoding>& input);
+
+// Returns the number of tokens reported by `lexy::tokenize()`.
+std::size_t json_tokenize(const lexy::buffer<lexy::utf8_encoding>& input);
+
+#endif // LEXY_BENCHMARK_PARSE_TREE_HPP_INCLUDED
@@ -0,0 +1,17 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define LEXY_TEST
+#include "../../examples/xml.cpp"
+
+#include "parse_tree.hpp"
+#include <lexy/action/parse_as_tree.hpp>
+#include <stdexcept>
+
+parse_tree xml_tree(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    parse_tree tree;
+    if (!lexy::parse_as_tree<grammar::document>(tree, input, lexy::noop))
+        throw std::runtime_error("invalid XML");
+    return tree;
+}
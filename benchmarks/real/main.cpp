@@ -0,0 +1,183 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <lexy/action/parse.hpp>
+#include <lexy/callback.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/buffer.hpp>
+#include <lexy/input/file.hpp>
+
+#if defined(__has_include) && __has_include(<charconv>)
+#    include <charconv>
+#    if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#        define LEXY_BENCHMARK_FROM_CHARS 1
+#    endif
+#endif
+
+namespace
+{
+// All numbers of the file, one per line.
+lexy::buffer<lexy::utf8_encoding> get_numbers(const char* file_name)
+{
+    auto path = std::string(LEXY_BENCHMARK_DATA) + "/" + file_name;
+    auto file = lexy::read_file<lexy::utf8_encoding>(path.c_str());
+    if (!file)
+        throw std::runtime_error("unable to read data file");
+
+    auto is_number_char = [](char c) {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+    };
+
+    std::string str;
+    auto        data = reinterpret_cast<const char*>(file.buffer().data());
+    auto        size = file.buffer().size();
+    for (auto i = std::size_t(0); i != size;)
+    {
+        if ((data[i] >= '0' && data[i] <= '9') || data[i] == '-')
+        {
+            auto begin = i;
+            while (i != size && is_number_char(data[i]))
+                ++i;
+            str.append(data + begin, i - begin);
+            str += '\n';
+        }
+        else if (data[i] == '"')
+        {
+            // Skip strings, they might contain digits.
+            for (++i; i != size && data[i] != '"'; ++i)
+                if (data[i] == '\\')
+                    ++i;
+            ++i;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return lexy::buffer<lexy::utf8_encoding>(str.data(), str.size());
+}
+
+// Random doubles printed with all their digits.
+lexy::buffer<lexy::utf8_encoding> get_random_numbers(std::size_t count)
+{
+    std::mt19937_64                        engine(42);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int>     exponent(-300, 300);
+
+    std::string str;
+    for (auto i = std::size_t(0); i != count; ++i)
+    {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.17g\n",
+                      std::ldexp(mantissa(engine), exponent(engine)));
+        str += buffer;
+    }
+    return lexy::buffer<lexy::utf8_encoding>(str.data(), str.size());
+}
+
+namespace grammar
+{
+    namespace dsl = lexy::dsl;
+
+    struct number
+    {
+        static constexpr auto rule  = dsl::sign + dsl::real<double>;
+        static constexpr auto value = lexy::as_float<double>;
+    };
+
+    // What you had to do without dsl::real.
+    struct number_strtod
+    {
+        static constexpr auto rule = [] {
+            auto fraction = dsl::lit_c<'.'> >> dsl::digits<>;
+            auto exponent = (dsl::lit_c<'e'> | dsl::lit_c<'E'>) >> (dsl::sign + dsl::digits<>);
+            return dsl::capture(dsl::token(dsl::opt(dsl::lit_c<'-'>) + dsl::digits<>
+                                           + dsl::opt(fraction) + dsl::opt(exponent)));
+        }();
+        static constexpr auto value
+            = lexy::callback<double>([](auto lex) {
+                  auto str = std::string(reinterpret_cast<const char*>(lex.data()), lex.size());
+                  return std::strtod(str.c_str(), nullptr);
+              });
+    };
+
+    template <typename Number>
+    struct numbers
+    {
+        static constexpr auto whitespace = dsl::ascii::newline;
+
+        static constexpr auto rule  = dsl::terminator(dsl::eof).list(dsl::p<Number>);
+        static constexpr auto value
+            = lexy::fold_inplace<double>(0.0, [](double& sum, double value) { sum += value; });
+    };
+} // namespace grammar
+
+template <typename Number>
+double bm_lexy(const lexy::buffer<lexy::utf8_encoding>& data)
+{
+    return lexy::parse<grammar::numbers<Number>>(data, lexy::noop).value();
+}
+
+double bm_strtod(const lexy::buffer<lexy::utf8_encoding>& data)
+{
+    auto sum = 0.0;
+
+    // The buffer is null-terminated.
+    auto cur = reinterpret_cast<const char*>(data.data());
+    auto end = cur + data.size();
+    while (cur != end)
+    {
+        char* number_end;
+        sum += std::strtod(cur, &number_end);
+        cur = number_end + 1;
+    }
+    return sum;
+}
+
+#if LEXY_BENCHMARK_FROM_CHARS
+double bm_from_chars(const lexy::buffer<lexy::utf8_encoding>& data)
+{
+    auto sum = 0.0;
+
+    auto cur = reinterpret_cast<const char*>(data.data());
+    auto end = cur + data.size();
+    while (cur != end)
+    {
+        double value;
+        cur = std::from_chars(cur, end, value).ptr + 1;
+        sum += value;
+    }
+    return sum;
+}
+#endif
+} // namespace
+
+int main()
+{
+    ankerl::nanobench::Bench b;
+
+    auto bench = [&](const char* title, const lexy::buffer<lexy::utf8_encoding>& data) {
+        b.title(title).relative(true);
+        b.unit("byte").batch(data.size());
+
+        b.run("std::strtod", [&] { return bm_strtod(data); });
+#if LEXY_BENCHMARK_FROM_CHARS
+        b.run("std::from_chars", [&] { return bm_from_chars(data); });
+#endif
+        b.run("lexy: capture + std::strtod", [&] { return bm_lexy<grammar::number_strtod>(data); });
+        b.run("lexy: dsl::real", [&] { return bm_lexy<grammar::number>(data); });
+    };
+
+    bench("canada.json", get_numbers("canada.json"));
+    bench("random", get_random_numbers(100'000));
+}
@@ -31,23 +31,27 @@ std::size_t bm_any(ankerl::nanobench::Bench& b)
     b.unit("byte").batch(small.size());
     b.run("any/manual/small", [&] { return count += bm_any(disable_swar(small.reader())); });
     b.run("any/swar/small", [&] { return count += bm_any(small.reader()); });
+    b.run("any/string/small", [&] { return count += bm_any(string_reader(small)); });
 
     b.minEpochIterations(100 * 1000ull);
     b.unit("byte").batch(ascii.size());
     b.run("any/manual/ascii", [&] { return count += bm_any(disable_swar(ascii.reader())); });
     b.run("any/swar/ascii", [&] { return count += bm_any(ascii.reader()); });
+    b.run("any/string/ascii", [&] { return count += bm_any(string_reader(ascii)); });
 
     b.minEpochIterations(100 * 1000ull);
     b.unit("byte").batch(few_unicode.size());
     b.run("any/manual/few_unicode",
           [&] { return count += bm_any(disable_swar(few_unicode.reader())); });
     b.run("any/swar/few_unicode", [&] { return count += bm_any(few_unicode.reader()); });
+    b.run("any/string/few_unicode", [&] { return count += bm_any(string_reader(few_unicode)); });
 
     b.minEpochIterations(100 * 1000ull);
     b.unit("byte").batch(much_unicode.size());
     b.run("any/manual/much_unicode",
           [&] { return count += bm_any(disable_swar(much_unicode.reader())); });
     b.run("any/swar/much_unicode", [&] { return count += bm_any(much_unicode.reader()); });
+    b.run("any/string/much_unicode", [&] { return count += bm_any(string_reader(much_unicode)); });
 
     return count;
 }
@@ -58,37 +58,51 @@ std::size_t bm_identifier(ankerl::nanobench::Bench& b)
     b.run("identifier-ascii/manual/words",
           [&] { return count += bm_ascii(disable_swar(words.reader())); });
     b.run("identifier-ascii/swar/words", [&] { return count += bm_ascii(words.reader()); });
+    b.run("identifier-ascii/string/words", [&] { return count += bm_ascii(string_reader(words)); });
     b.run("identifier-unicode/manual/words",
           [&] { return count += bm_unicode(disable_swar(words.reader())); });
     b.run("identifier-unicode/swar/words", [&] { return count += bm_unicode(words.reader()); });
+    b.run("identifier-unicode/string/words",
+          [&] { return count += bm_unicode(string_reader(words)); });
 
     b.unit("byte").batch(ascii.size());
     b.run("identifier-ascii/manual/ascii",
           [&] { return count += bm_ascii(disable_swar(ascii.reader())); });
     b.run("identifier-ascii/swar/ascii", [&] { return count += bm_ascii(ascii.reader()); });
+    b.run("identifier-ascii/string/ascii", [&] { return count += bm_ascii(string_reader(ascii)); });
     b.run("identifier-unicode/manual/ascii",
           [&] { return count += bm_unicode(disable_swar(ascii.reader())); });
     b.run("identifier-unicode/swar/ascii", [&] { return count += bm_ascii(ascii.reader()); });
+    b.run("identifier-unicode/string/ascii",
+          [&] { return count += bm_ascii(string_reader(ascii)); });
 
     b.unit("byte").batch(few_unicode.size());
     b.run("identifier-ascii/manual/few_unicode",
           [&] { return count += bm_ascii(disable_swar(few_unicode.reader())); });
     b.run("identifier-ascii/swar/few_unicode",
           [&] { return count += bm_ascii(few_unicode.reader()); });
+    b.run("identifier-ascii/string/few_unicode",
+          [&] { return count += bm_ascii(string_reader(few_unicode)); });
     b.run("identifier-unicode/manual/few_unicode",
           [&] { return count += bm_unicode(disable_swar(few_unicode.reader())); });
     b.run("identifier-unicode/swar/few_unicode",
           [&] { return count += bm_unicode(few_unicode.reader()); });
+    b.run("identifier-unicode/string/few_unicode",
+          [&] { return count += bm_unicode(string_reader(few_unicode)); });
 
     b.unit("byte").batch(much_unicode.size());
     b.run("identifier-ascii/manual/much_unicode",
           [&] { return count += bm_ascii(disable_swar(much_unicode.reader())); });
     b.run("identifier-ascii/swar/much_unicode",
           [&] { return count += bm_ascii(much_unicode.reader()); });
+    b.run("identifier-ascii/string/much_unicode",
+          [&] { return count += bm_ascii(string_reader(much_unicode)); });
     b.run("identifier-unicode/manual/much_unicode",
           [&] { return count += bm_unicode(disable_swar(much_unicode.reader())); });
     b.run("identifier-unicode/swar/much_unicode",
           [&] { return count += bm_unicode(much_unicode.reader()); });
+    b.run("identifier-unicode/string/much_unicode",
+          [&] { return count += bm_unicode(string_reader(much_unicode)); });
 
     return count;
 }
@@ -3,6 +3,7 @@
 
 #include "swar.hpp"
 
+#include <lexy/dsl/case_folding.hpp>
 #include <lexy/dsl/literal.hpp>
 
 namespace
@@ -48,6 +49,57 @@ LEXY_NOINLINE std::size_t bm_alphabet(Reader reader)
     }
     return count;
 }
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_cf_select(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(lexy::dsl::ascii::case_folding(LEXY_LIT("select")), reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_cf_alphabet(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(lexy::dsl::ascii::case_folding(
+                                      LEXY_LIT("abcdefghijklmnopqrstuvwxyz")),
+                                  reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_cf_keywords(Reader reader)
+{
+    constexpr auto keywords = [] {
+        auto cf = lexy::dsl::ascii::case_folding;
+        return lexy::dsl::literal_set(cf(LEXY_LIT("select")), cf(LEXY_LIT("insert")),
+                                      cf(LEXY_LIT("delete")), cf(LEXY_LIT("update")),
+                                      cf(LEXY_LIT("distinct")), cf(LEXY_LIT("transaction")));
+    }();
+
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(keywords, reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
 } // namespace
 
 std::size_t bm_lit(ankerl::nanobench::Bench& b)
@@ -72,6 +124,29 @@ std::size_t bm_lit(ankerl::nanobench::Bench& b)
     b.run("lit/manual/alphabet", [&] { return count += bm_alphabet(disable_swar(a.reader())); });
     b.run("lit/swar/alphabet", [&] { return count += bm_alphabet(a.reader()); });
 
+    auto select = repeat_buffer_padded(10 * 1024ull, "SeLeCt");
+    b.minEpochIterations(10 * 1000ull);
+    b.unit("byte").batch(select.size());
+    b.run("lit/manual/case_folding/select",
+          [&] { return count += bm_cf_select(disable_swar(select.reader())); });
+    b.run("lit/swar/case_folding/select", [&] { return count += bm_cf_select(select.reader()); });
+
+    auto cf_alphabet = repeat_buffer_padded(10 * 1024ull, "abcdefghijklmNOPQRSTUVWXYZ");
+    b.minEpochIterations(10 * 1000ull);
+    b.unit("byte").batch(cf_alphabet.size());
+    b.run("lit/manual/case_folding/alphabet",
+          [&] { return count += bm_cf_alphabet(disable_swar(cf_alphabet.reader())); });
+    b.run("lit/swar/case_folding/alphabet",
+          [&] { return count += bm_cf_alphabet(cf_alphabet.reader()); });
+
+    auto keywords = repeat_buffer_padded(10 * 1024ull, "Select DISTINCT Transaction ");
+    b.minEpochIterations(10 * 1000ull);
+    b.unit("byte").batch(keywords.size());
+    b.run("lit/manual/case_folding/keywords",
+          [&] { return count += bm_cf_keywords(disable_swar(keywords.reader())); });
+    b.run("lit/swar/case_folding/keywords",
+          [&] { return count += bm_cf_keywords(keywords.reader()); });
+
     return count;
 }
 
@@ -83,7 +83,9 @@ std::size_t bm_digits(ankerl::nanobench::Bench& b);
 std::size_t bm_delimited(ankerl::nanobench::Bench& b);
 std::size_t bm_identifier(ankerl::nanobench::Bench& b);
 std::size_t bm_lit(ankerl::nanobench::Bench& b);
+std::size_t bm_reserved(ankerl::nanobench::Bench& b);
 std::size_t bm_until(ankerl::nanobench::Bench& b);
+std::size_t bm_utf16(ankerl::nanobench::Bench& b);
 
 int main(int argc, char* argv[])
 {
@@ -98,7 +100,11 @@ int main(int argc, char* argv[])
         bm_identifier(b);
     if (argc == 1 || argv[1] == std::string_view("lit"))
         bm_lit(b);
+    if (argc == 1 || argv[1] == std::string_view("reserved"))
+        bm_reserved(b);
     if (argc == 1 || argv[1] == std::string_view("until"))
         bm_until(b);
+    if (argc == 1 || argv[1] == std::string_view("utf16"))
+        bm_utf16(b);
 }
 
@@ -0,0 +1,117 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "swar.hpp"
+
+#include <lexy/action/match.hpp>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/identifier.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/loop.hpp>
+#include <lexy/dsl/separator.hpp>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace
+{
+// The first two characters make each keyword unique, the length varies between 2 and 10.
+constexpr std::size_t keyword_length(std::size_t kw)
+{
+    return 2 + kw * 5 % 9;
+}
+constexpr char keyword_char(std::size_t kw, std::size_t idx)
+{
+    if (idx == 0)
+        return static_cast<char>('a' + kw % 26);
+    else if (idx == 1)
+        return static_cast<char>('a' + kw / 26 % 26);
+    else
+        return static_cast<char>('a' + (kw * 7 + idx * 3) % 26);
+}
+
+template <std::size_t Kw, std::size_t... Idx>
+constexpr auto keyword(std::index_sequence<Idx...>)
+{
+    return lexy::dsl::_lit<char, keyword_char(Kw, Idx)...>{};
+}
+
+template <std::size_t... Kw>
+constexpr auto reserved_identifier(std::index_sequence<Kw...>)
+{
+    auto id = lexy::dsl::identifier(lexy::dsl::ascii::alpha);
+    if constexpr (sizeof...(Kw) == 0)
+        return id;
+    else
+        return id.reserve(keyword<Kw>(std::make_index_sequence<keyword_length(Kw)>{})...);
+}
+
+template <std::size_t KeywordCount>
+struct identifiers
+{
+    static constexpr auto rule = [] {
+        namespace dsl = lexy::dsl;
+
+        // A reserved identifier is matched as a plain word instead.
+        auto id = reserved_identifier(std::make_index_sequence<KeywordCount>{});
+        return dsl::list(id | dsl::while_one(dsl::ascii::alpha), dsl::sep(dsl::lit_c<' '>));
+    }();
+};
+
+// Half of the words are keywords, the others are random words of the same lengths.
+lexy::buffer<lexy::default_encoding> identifier_buffer(std::size_t size, std::size_t keywords)
+{
+    std::default_random_engine                 engine(42);
+    std::uniform_int_distribution<std::size_t> kw_dist(0, keywords - 1);
+    std::uniform_int_distribution<int>         char_dist('a', 'z');
+
+    std::string str;
+    while (str.size() < size)
+    {
+        auto kw = kw_dist(engine);
+        if (char_dist(engine) % 2 == 0)
+        {
+            for (auto i = std::size_t(0); i != keyword_length(kw); ++i)
+                str.push_back(keyword_char(kw, i));
+        }
+        else
+        {
+            for (auto i = std::size_t(0); i != keyword_length(kw); ++i)
+                str.push_back(static_cast<char>(char_dist(engine)));
+        }
+        str.push_back(' ');
+    }
+    str.pop_back();
+
+    return lexy::buffer<lexy::default_encoding>(str.data(), str.size());
+}
+
+template <std::size_t KeywordCount>
+bool bm_reserved(const lexy::buffer<lexy::default_encoding>& buffer)
+{
+    return lexy::match<identifiers<KeywordCount>>(buffer);
+}
+} // namespace
+
+std::size_t bm_reserved(ankerl::nanobench::Bench& b)
+{
+    auto count = std::size_t(0);
+
+    auto words10  = identifier_buffer(100 * 1024ull, 10);
+    auto words100 = identifier_buffer(100 * 1024ull, 100);
+    auto words500 = identifier_buffer(100 * 1024ull, 500);
+
+    b.minEpochIterations(20);
+
+    b.unit("byte").batch(words10.size());
+    b.run("reserved/0/10", [&] { return count += bm_reserved<0>(words10); });
+    b.run("reserved/10/10", [&] { return count += bm_reserved<10>(words10); });
+    b.unit("byte").batch(words100.size());
+    b.run("reserved/0/100", [&] { return count += bm_reserved<0>(words100); });
+    b.run("reserved/100/100", [&] { return count += bm_reserved<100>(words100); });
+    b.unit("byte").batch(words500.size());
+    b.run("reserved/0/500", [&] { return count += bm_reserved<0>(words500); });
+    b.run("reserved/500/500", [&] { return count += bm_reserved<500>(words500); });
+
+    return count;
+}
@@ -68,6 +68,73 @@ constexpr auto disable_swar(lexy::_br<Encoding> reader)
     return swar_disabled_reader<Encoding>(reader.position());
 }
 
+// The reader of a range without a sentinel that doesn't use SWAR.
+template <typename Encoding>
+class swar_disabled_range_reader
+{
+public:
+    using encoding = Encoding;
+    using iterator = const typename Encoding::char_type*;
+
+    struct marker
+    {
+        iterator _it;
+
+        constexpr iterator position() const noexcept
+        {
+            return _it;
+        }
+    };
+
+    explicit swar_disabled_range_reader(iterator begin, iterator end) noexcept
+    : _cur(begin), _end(end)
+    {}
+
+    auto peek() const noexcept
+    {
+        if (_cur == _end)
+            return encoding::eof();
+        else
+            return encoding::to_int_type(*_cur);
+    }
+
+    void bump() noexcept
+    {
+        ++_cur;
+    }
+
+    iterator position() const noexcept
+    {
+        return _cur;
+    }
+
+    marker current() const noexcept
+    {
+        return {_cur};
+    }
+    void reset(marker m) noexcept
+    {
+        _cur = m._it;
+    }
+
+private:
+    iterator _cur;
+    iterator _end;
+};
+
+inline auto disable_swar(lexy::_pr16 reader)
+{
+    auto end = reader.position() + reader.remaining();
+    return swar_disabled_range_reader<lexy::utf16_encoding>(reader.position(), end);
+}
+
+// The reader of a string_input over the buffer, which doesn't have the padding for SWAR.
+template <typename Encoding>
+constexpr auto string_reader(const lexy::buffer<Encoding>& buffer)
+{
+    return lexy::_range_reader<Encoding>(buffer.data(), buffer.data() + buffer.size());
+}
+
 lexy::buffer<lexy::utf8_encoding> random_buffer(std::size_t size, float unicode_ratio);
 
 lexy::buffer<lexy::utf8_encoding> repeat_buffer_padded(std::size_t size, const char* str);
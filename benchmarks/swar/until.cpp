@@ -48,42 +48,54 @@ std::size_t bm_until(ankerl::nanobench::Bench& b)
     b.unit("byte").batch(small.size());
     b.run("until/manual/small", [&] { return count += bm_until(disable_swar(small.reader())); });
     b.run("until/swar/small", [&] { return count += bm_until(small.reader()); });
+    b.run("until/string/small", [&] { return count += bm_until(string_reader(small)); });
 
     b.unit("byte").batch(ascii.size());
     b.run("until/manual/ascii", [&] { return count += bm_until(disable_swar(ascii.reader())); });
     b.run("until/swar/ascii", [&] { return count += bm_until(ascii.reader()); });
+    b.run("until/string/ascii", [&] { return count += bm_until(string_reader(ascii)); });
 
     b.unit("byte").batch(few_unicode.size());
     b.run("until/manual/few_unicode",
           [&] { return count += bm_until(disable_swar(few_unicode.reader())); });
     b.run("until/swar/few_unicode", [&] { return count += bm_until(few_unicode.reader()); });
+    b.run("until/string/few_unicode",
+          [&] { return count += bm_until(string_reader(few_unicode)); });
 
     b.unit("byte").batch(much_unicode.size());
     b.run("until/manual/much_unicode",
           [&] { return count += bm_until(disable_swar(much_unicode.reader())); });
     b.run("until/swar/much_unicode", [&] { return count += bm_until(much_unicode.reader()); });
+    b.run("until/string/much_unicode",
+          [&] { return count += bm_until(string_reader(much_unicode)); });
 
     b.unit("byte").batch(small.size());
     b.run("until_eof/manual/small",
           [&] { return count += bm_until_eof(disable_swar(small.reader())); });
     b.run("until_eof/swar/small", [&] { return count += bm_until_eof(small.reader()); });
+    b.run("until_eof/string/small", [&] { return count += bm_until_eof(string_reader(small)); });
 
     b.unit("byte").batch(ascii.size());
     b.run("until_eof/manual/ascii",
           [&] { return count += bm_until_eof(disable_swar(ascii.reader())); });
     b.run("until_eof/swar/ascii", [&] { return count += bm_until_eof(ascii.reader()); });
+    b.run("until_eof/string/ascii", [&] { return count += bm_until_eof(string_reader(ascii)); });
 
     b.unit("byte").batch(few_unicode.size());
     b.run("until_eof/manual/few_unicode",
           [&] { return count += bm_until_eof(disable_swar(few_unicode.reader())); });
     b.run("until_eof/swar/few_unicode",
           [&] { return count += bm_until_eof(few_unicode.reader()); });
+    b.run("until_eof/string/few_unicode",
+          [&] { return count += bm_until_eof(string_reader(few_unicode)); });
 
     b.unit("byte").batch(much_unicode.size());
     b.run("until_eof/manual/much_unicode",
           [&] { return count += bm_until_eof(disable_swar(much_unicode.reader())); });
     b.run("until_eof/swar/much_unicode",
           [&] { return count += bm_until_eof(much_unicode.reader()); });
+    b.run("until_eof/string/much_unicode",
+          [&] { return count += bm_until_eof(string_reader(much_unicode)); });
 
     return count;
 }
@@ -0,0 +1,165 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "swar.hpp"
+
+#include <lexy/_detail/code_point.hpp>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/code_point.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/identifier.hpp>
+#include <lexy/dsl/newline.hpp>
+#include <lexy/dsl/until.hpp>
+#include <string>
+
+namespace
+{
+lexy::buffer<lexy::utf16_encoding> to_utf16(const lexy::buffer<lexy::utf8_encoding>& input)
+{
+    std::u16string result;
+
+    auto reader = input.reader();
+    while (reader.peek() != lexy::utf8_encoding::eof())
+    {
+        auto cp = lexy::_detail::parse_code_point(reader);
+        if (cp.error == lexy::_detail::cp_error::success
+            || cp.error == lexy::_detail::cp_error::surrogate)
+        {
+            char16_t buffer[2];
+            auto size = lexy::_detail::encode_code_point<lexy::utf16_encoding>(cp.cp, buffer, 2);
+            result.append(buffer, size);
+            reader.reset(cp.end);
+        }
+        else
+        {
+            reader.bump();
+        }
+    }
+
+    return lexy::buffer<lexy::utf16_encoding>(result.data(), result.size());
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_any(Reader reader)
+{
+    auto begin = reader.position();
+    lexy::try_match_token(lexy::dsl::any, reader);
+    auto end = reader.position();
+
+    return lexy::_detail::range_size(begin, end);
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_until(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(lexy::dsl::until(lexy::dsl::newline), reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_identifier(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(lexy::dsl::identifier(lexy::dsl::ascii::word).pattern(), reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_code_point(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        // Matches code points until the first unpaired surrogate.
+        if (lexy::try_match_token(lexy::dsl::identifier(lexy::dsl::code_point).pattern(), reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+
+template <typename Reader>
+LEXY_NOINLINE std::size_t bm_digits(Reader reader)
+{
+    auto count = 0u;
+    while (reader.peek() != Reader::encoding::eof())
+    {
+        if (lexy::try_match_token(lexy::dsl::digits<>, reader))
+            ++count;
+        else
+            reader.bump();
+    }
+    return count;
+}
+} // namespace
+
+std::size_t bm_utf16(ankerl::nanobench::Bench& b)
+{
+    auto count = std::size_t(0);
+
+    auto lines = to_utf16(repeat_buffer_padded(
+        10 * 1024ull,
+        "abc\nabcdefghijkl\r\nabcdefghijklmnopqrstuvwxyz\nabcdfghijkl\rmnopqrstuvwxyz\n"));
+    auto words = to_utf16(repeat_buffer_padded(
+        10 * 1024ull,
+        "Hello, World, how, are, you, lexy, ankerl, nanobench, Bench, bm_identifier, std::stringstream, rotate, antidisestablishmentarianism, Kurzfristenergieversorgungssicherungsmaßnahmenverordnung"));
+    auto numbers = to_utf16(repeat_buffer_padded(
+        10 * 1024ull, "0, 1, 42, 1024, 65535, 3.1415926535, 2.7182818284, 18446744073709551615"));
+    auto ascii        = to_utf16(random_buffer(10 * 1024ull, 0));
+    auto few_unicode  = to_utf16(random_buffer(10 * 1024ull, 0.1f));
+    auto much_unicode = to_utf16(random_buffer(10 * 1024ull, 0.5f));
+
+    b.minEpochIterations(100);
+
+    b.unit("code unit").batch(ascii.size());
+    b.run("utf16-any/manual/ascii", [&] { return count += bm_any(disable_swar(ascii.reader())); });
+    b.run("utf16-any/swar/ascii", [&] { return count += bm_any(ascii.reader()); });
+
+    b.unit("code unit").batch(lines.size());
+    b.run("utf16-until/manual/lines",
+          [&] { return count += bm_until(disable_swar(lines.reader())); });
+    b.run("utf16-until/swar/lines", [&] { return count += bm_until(lines.reader()); });
+
+    b.unit("code unit").batch(few_unicode.size());
+    b.run("utf16-until/manual/few_unicode",
+          [&] { return count += bm_until(disable_swar(few_unicode.reader())); });
+    b.run("utf16-until/swar/few_unicode", [&] { return count += bm_until(few_unicode.reader()); });
+
+    b.unit("code unit").batch(words.size());
+    b.run("utf16-identifier/manual/words",
+          [&] { return count += bm_identifier(disable_swar(words.reader())); });
+    b.run("utf16-identifier/swar/words", [&] { return count += bm_identifier(words.reader()); });
+
+    b.unit("code unit").batch(few_unicode.size());
+    b.run("utf16-code_point/manual/few_unicode",
+          [&] { return count += bm_code_point(disable_swar(few_unicode.reader())); });
+    b.run("utf16-code_point/swar/few_unicode",
+          [&] { return count += bm_code_point(few_unicode.reader()); });
+
+    b.unit("code unit").batch(much_unicode.size());
+    b.run("utf16-code_point/manual/much_unicode",
+          [&] { return count += bm_code_point(disable_swar(much_unicode.reader())); });
+    b.run("utf16-code_point/swar/much_unicode",
+          [&] { return count += bm_code_point(much_unicode.reader()); });
+
+    b.unit("code unit").batch(numbers.size());
+    b.run("utf16-digits/manual/numbers",
+          [&] { return count += bm_digits(disable_swar(numbers.reader())); });
+    b.run("utf16-digits/swar/numbers", [&] { return count += bm_digits(numbers.reader()); });
+
+    return count;
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <random>
+#include <vector>
+
+#include <lexy/action/match.hpp>
+#include <lexy/code_point.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/string_input.hpp>
+
+namespace
+{
+// Identifiers of various scripts, as they'd appear in source code.
+const char32_t* identifiers[] = {
+    U"value",      U"parse_tree",  U"HttpRequest", U"größe",    U"Straße",   U"façade",
+    U"naïve",      U"señal",       U"αλφα",        U"Ωμέγα",    U"λ",        U"переменная",
+    U"Значение",   U"счёт",        U"変数",        U"関数名",   U"データ",   U"변수",
+    U"함수",       U"متغير",       U"दालचीनी",     U"संख्या",   U"ตัวแปร",   U"מִשְׁתַּנֶּה",
+    U"ⅷ_roman",    U"𝔣𝔯𝔞𝔨𝔱𝔲𝔯", U"𐐷𐑌",         U"x_1",       U"µs",       U"Ærø",
+};
+
+// Mixed-script identifiers separated by spaces, both as code points and UTF-8.
+struct data
+{
+    std::vector<char32_t>     code_points;
+    std::vector<LEXY_CHAR8_T> utf8;
+};
+
+data get_identifiers(std::size_t count)
+{
+    std::mt19937                  engine(42);
+    std::uniform_int_distribution dist(std::size_t(0), std::size(identifiers) - 1);
+
+    data result;
+    for (auto i = std::size_t(0); i != count; ++i)
+    {
+        for (auto str = identifiers[dist(engine)]; *str; ++str)
+            result.code_points.push_back(*str);
+        result.code_points.push_back(U' ');
+    }
+
+    for (auto cp : result.code_points)
+    {
+        LEXY_CHAR8_T buffer[4];
+        auto size = lexy::_detail::encode_code_point<lexy::utf8_encoding>(cp, buffer, 4);
+        result.utf8.insert(result.utf8.end(), buffer, buffer + size);
+    }
+
+    return result;
+}
+
+std::size_t bm_case_fold(const data& data)
+{
+    std::size_t result = 0;
+    for (auto cp : data.code_points)
+        result += lexy::simple_case_fold(lexy::code_point(cp)).value();
+    return result;
+}
+
+std::size_t bm_category(const data& data)
+{
+    std::size_t result = 0;
+    for (auto cp : data.code_points)
+        result += lexy::code_point(cp).general_category();
+    return result;
+}
+
+std::size_t bm_xid(const data& data)
+{
+    std::size_t result = 0;
+    for (auto cp : data.code_points)
+        result += lexy::_detail::code_point_has_properties<LEXY_UNICODE_PROPERTY(xid_start),
+                                                           LEXY_UNICODE_PROPERTY(xid_continue)>(cp);
+    return result;
+}
+
+namespace grammar
+{
+    namespace dsl = lexy::dsl;
+
+    struct identifiers
+    {
+        static constexpr auto rule = [] {
+            auto id = dsl::identifier(dsl::unicode::xid_start_underscore,
+                                      dsl::unicode::xid_continue);
+            return dsl::list(id, dsl::sep(dsl::lit_c<' '>));
+        }();
+    };
+} // namespace grammar
+
+bool bm_identifier(const data& data)
+{
+    auto input = lexy::string_input<lexy::utf8_encoding>(data.utf8.data(), data.utf8.size() - 1);
+    return lexy::match<grammar::identifiers>(input);
+}
+} // namespace
+
+int main()
+{
+    ankerl::nanobench::Bench b;
+
+    auto data = get_identifiers(10'000);
+    b.title("Unicode database").relative(true);
+
+    b.unit("lookup").batch(data.code_points.size());
+    b.run("lexy::simple_case_fold", [&] { return bm_case_fold(data); });
+    b.run("lexy::code_point::general_category", [&] { return bm_category(data); });
+    b.run("code point properties", [&] { return bm_xid(data); });
+
+    b.unit("byte").batch(data.utf8.size());
+    b.run("identifier list", [&] { return bm_identifier(data); });
+}
@@ -0,0 +1,8 @@
+// INPUT:<<=
+struct production
+{
+    static constexpr auto rule = [] {
+        auto op = dsl::literal_set(LEXY_LIT("<"), LEXY_LIT("<="), LEXY_LIT("<<"), LEXY_LIT("<<="));
+        return dsl::token_dfa(op) + dsl::eof;
+    }();
+};
@@ -190,7 +190,7 @@ namespace grammar
     // N bytes, where N is given by a varint.
     struct field_bytes
     {
-        static constexpr auto rule  = dsl::repeat(dsl::p<varint>).capture(dsl::byte);
+        static constexpr auto rule  = dsl::blob(dsl::p<varint>);
         static constexpr auto value = lexy::construct<ast::field_bytes>;
     };
 
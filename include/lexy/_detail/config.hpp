@@ -142,6 +142,30 @@ using _char8_t = unsigned char;
 
 #endif
 
+//=== constant evaluation ===//
+#ifndef LEXY_HAS_IS_CONSTANT_EVALUATED
+#    if defined(__has_builtin)
+#        if __has_builtin(__builtin_is_constant_evaluated)
+#            define LEXY_HAS_IS_CONSTANT_EVALUATED 1
+#        endif
+#    elif defined(__GNUC__) && __GNUC__ >= 9
+#        define LEXY_HAS_IS_CONSTANT_EVALUATED 1
+#    elif defined(_MSC_VER) && _MSC_VER >= 1925
+#        define LEXY_HAS_IS_CONSTANT_EVALUATED 1
+#    endif
+#
+#    ifndef LEXY_HAS_IS_CONSTANT_EVALUATED
+#        define LEXY_HAS_IS_CONSTANT_EVALUATED 0
+#    endif
+#endif
+
+#if LEXY_HAS_IS_CONSTANT_EVALUATED
+#    define LEXY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+//   Conservatively assume constant evaluation, so only the constexpr code path is taken.
+#    define LEXY_IS_CONSTANT_EVALUATED() true
+#endif
+
 //=== endianness ===//
 #ifndef LEXY_IS_LITTLE_ENDIAN
 #    if defined(__BYTE_ORDER__)
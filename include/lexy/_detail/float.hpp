@@ -0,0 +1,519 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_DETAIL_FLOAT_HPP_INCLUDED
+#define LEXY_DETAIL_FLOAT_HPP_INCLUDED
+
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <lexy/_detail/assert.hpp>
+#include <lexy/_detail/config.hpp>
+
+#include <lexy/_detail/float_table.hpp>
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+// Conversion of a decimal floating point number into the nearest `float` or `double`.
+// The algorithm is the one from "Number Parsing at a Gigabyte per Second" by Daniel Lemire,
+// as implemented in the fast_float library:
+// * If mantissa and exponent are small enough, we can compute the result using a single
+//   floating point multiplication or division (Clinger's fast path).
+// * Otherwise, we multiply the mantissa by a 128-bit approximation of the power of ten
+//   (Eisel-Lemire), which always produces the correctly rounded result for mantissas with up to
+//   19 digits.
+// * If the number has more digits, we run Eisel-Lemire for the truncated mantissa and its
+//   successor; only if they disagree we need to compare against the exact decimal digits using
+//   big integer arithmetic.
+
+namespace lexy::_detail
+{
+template <typename T>
+struct float_traits;
+
+template <>
+struct float_traits<double>
+{
+    using bits_type = std::uint64_t;
+
+    static constexpr int mantissa_bits  = 52;
+    static constexpr int min_exponent   = -1023;
+    static constexpr int infinite_power = 0x7FF;
+
+    // Outside this range, the result is always zero or infinity.
+    static constexpr int smallest_power_of_ten = -342;
+    static constexpr int largest_power_of_ten  = 308;
+
+    // Only in this range can the result be exactly halfway between two floats.
+    static constexpr int min_exponent_round_to_even = -4;
+    static constexpr int max_exponent_round_to_even = 23;
+
+    static constexpr int           max_exponent_fast_path = 22;
+    static constexpr std::uint64_t max_mantissa_fast_path = std::uint64_t(2) << mantissa_bits;
+
+    static constexpr double exact_power_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                                    1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template <>
+struct float_traits<float>
+{
+    using bits_type = std::uint32_t;
+
+    static constexpr int mantissa_bits  = 23;
+    static constexpr int min_exponent   = -127;
+    static constexpr int infinite_power = 0xFF;
+
+    static constexpr int smallest_power_of_ten = -65;
+    static constexpr int largest_power_of_ten  = 38;
+
+    static constexpr int min_exponent_round_to_even = -17;
+    static constexpr int max_exponent_round_to_even = 10;
+
+    static constexpr int           max_exponent_fast_path = 10;
+    static constexpr std::uint64_t max_mantissa_fast_path = std::uint64_t(2) << mantissa_bits;
+
+    static constexpr float exact_power_of_ten[]
+        = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+// If floating point operations are evaluated with a higher precision, the fast path suffers from
+// double rounding.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+constexpr auto float_has_fast_path = false;
+#else
+constexpr auto float_has_fast_path = true;
+#endif
+} // namespace lexy::_detail
+
+//=== decimal scanning ===//
+namespace lexy::_detail
+{
+struct decimal_float
+{
+    std::int64_t exponent;
+    bool         truncated; // Whether there were non-zero digits after max_digits.
+    bool         negative;
+};
+
+// Scans a number of the form `[sign] digits [. digits] [(e|E) [sign] digits]`, passing the first
+// `max_digits` significant digits to `fn`; the result is `digits * 10^exponent`.
+// Any other characters are treated as digit separators and ignored.
+template <typename Iterator, typename Fn>
+constexpr decimal_float scan_decimal_float(Iterator cur, Iterator end, int max_digits, Fn fn)
+{
+    decimal_float result{0, false, false};
+    if (cur != end && (*cur == '-' || *cur == '+'))
+    {
+        result.negative = *cur == '-';
+        ++cur;
+    }
+
+    auto digit_count = 0;
+    auto in_fraction = false;
+    for (; cur != end; ++cur)
+    {
+        auto c = *cur;
+        if (c >= '0' && c <= '9')
+        {
+            auto digit = static_cast<unsigned>(c - '0');
+            if (digit_count == 0 && digit == 0)
+            {
+                // Leading zeros are not significant.
+                if (in_fraction)
+                    --result.exponent;
+            }
+            else if (digit_count < max_digits)
+            {
+                fn(digit);
+                ++digit_count;
+                if (in_fraction)
+                    --result.exponent;
+            }
+            else
+            {
+                if (!in_fraction)
+                    ++result.exponent;
+                if (digit != 0)
+                    result.truncated = true;
+            }
+        }
+        else if (c == '.')
+        {
+            in_fraction = true;
+        }
+        else if (c == 'e' || c == 'E')
+        {
+            ++cur;
+            break;
+        }
+    }
+
+    auto exponent_negative = false;
+    if (cur != end && (*cur == '-' || *cur == '+'))
+    {
+        exponent_negative = *cur == '-';
+        ++cur;
+    }
+
+    // The exponent saturates: something that big is either zero or infinity anyway.
+    constexpr auto max_exponent = std::int64_t(1) << 40;
+    auto           exponent     = std::int64_t(0);
+    for (; cur != end; ++cur)
+    {
+        auto c = *cur;
+        if (c >= '0' && c <= '9' && exponent < max_exponent)
+            exponent = exponent * 10 + (c - '0');
+    }
+    result.exponent += exponent_negative ? -exponent : exponent;
+
+    return result;
+}
+} // namespace lexy::_detail
+
+//=== Eisel-Lemire ===//
+namespace lexy::_detail
+{
+struct float_uint128
+{
+    std::uint64_t low, high;
+};
+
+inline float_uint128 float_full_multiplication(std::uint64_t lhs, std::uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+
+    auto product = uint128(lhs) * rhs;
+    return {static_cast<std::uint64_t>(product), static_cast<std::uint64_t>(product >> 64)};
+#elif defined(_MSC_VER) && defined(_M_X64)
+    float_uint128 result;
+    result.low = _umul128(lhs, rhs, &result.high);
+    return result;
+#else
+    auto lo_lo = (lhs & 0xFFFF'FFFF) * (rhs & 0xFFFF'FFFF);
+    auto hi_lo = (lhs >> 32) * (rhs & 0xFFFF'FFFF);
+    auto lo_hi = (lhs & 0xFFFF'FFFF) * (rhs >> 32);
+    auto hi_hi = (lhs >> 32) * (rhs >> 32);
+
+    auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+    return {(cross << 32) | (lo_lo & 0xFFFF'FFFF), (hi_lo >> 32) + (cross >> 32) + hi_hi};
+#endif
+}
+
+inline int float_leading_zeros(std::uint64_t value)
+{
+    LEXY_PRECONDITION(value != 0);
+#if defined(__GNUC__)
+    return __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long bit_idx;
+    _BitScanReverse64(&bit_idx, value);
+    return 63 - int(bit_idx);
+#else
+    auto result = 0;
+    while ((value & (std::uint64_t(1) << 63)) == 0)
+    {
+        value <<= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+// The biased exponent and the mantissa without the implicit bit.
+struct float_bits
+{
+    std::uint64_t mantissa;
+    int           power2;
+
+    friend bool operator==(float_bits lhs, float_bits rhs)
+    {
+        return lhs.mantissa == rhs.mantissa && lhs.power2 == rhs.power2;
+    }
+    friend bool operator!=(float_bits lhs, float_bits rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+// Computes the float closest to `w * 10^q`.
+template <typename T>
+float_bits compute_float(std::int64_t q, std::uint64_t w)
+{
+    using traits = float_traits<T>;
+
+    if (w == 0 || q < traits::smallest_power_of_ten)
+        return {0, 0};
+    else if (q > traits::largest_power_of_ten)
+        return {0, traits::infinite_power};
+
+    auto lz = float_leading_zeros(w);
+    w <<= lz;
+
+    // We only need the upper mantissa_bits + 3 bits of the product to be exact; if they could be
+    // affected by the truncated bits of the power of five, we use the second word as well.
+    auto index   = 2 * static_cast<int>(q - power_of_five_min);
+    auto product = float_full_multiplication(w, power_of_five_128[index]);
+
+    constexpr auto precision_mask = ~std::uint64_t(0) >> (traits::mantissa_bits + 3);
+    if ((product.high & precision_mask) == precision_mask)
+    {
+        auto second = float_full_multiplication(w, power_of_five_128[index + 1]);
+        product.low += second.high;
+        if (second.high > product.low)
+            ++product.high;
+    }
+
+    auto upperbit = static_cast<int>(product.high >> 63);
+    auto shift    = upperbit + 64 - traits::mantissa_bits - 3;
+
+    // floor(log2(10^q)) = floor(q * log2(10)) = ((152170 + 65536) * q) >> 16 for the relevant q.
+    auto power2 = (((152170 + 65536) * static_cast<int>(q)) >> 16) + 63 + upperbit - lz
+                  - traits::min_exponent;
+
+    float_bits result{product.high >> shift, power2};
+    if (result.power2 <= 0)
+    {
+        // We have a subnormal number.
+        if (-result.power2 + 1 >= 64)
+            return {0, 0};
+
+        result.mantissa >>= -result.power2 + 1;
+        result.mantissa += result.mantissa & 1;
+        result.mantissa >>= 1;
+
+        // Rounding might have turned it into a normal number.
+        result.power2 = result.mantissa < (std::uint64_t(1) << traits::mantissa_bits) ? 0 : 1;
+        return result;
+    }
+
+    if (product.low <= 1 && q >= traits::min_exponent_round_to_even
+        && q <= traits::max_exponent_round_to_even && (result.mantissa & 3) == 1)
+    {
+        // We're exactly halfway between two floats, round to even.
+        if ((result.mantissa << shift) == product.high)
+            result.mantissa &= ~std::uint64_t(1);
+    }
+
+    result.mantissa += result.mantissa & 1;
+    result.mantissa >>= 1;
+    if (result.mantissa >= (std::uint64_t(2) << traits::mantissa_bits))
+    {
+        result.mantissa = std::uint64_t(1) << traits::mantissa_bits;
+        ++result.power2;
+    }
+    result.mantissa &= ~(std::uint64_t(1) << traits::mantissa_bits);
+
+    if (result.power2 >= traits::infinite_power)
+        return {0, traits::infinite_power};
+    return result;
+}
+
+template <typename T>
+T float_from_bits(float_bits bits, bool negative)
+{
+    using traits    = float_traits<T>;
+    using bits_type = typename traits::bits_type;
+
+    auto value = static_cast<bits_type>(bits.mantissa)
+                 | static_cast<bits_type>(bits_type(bits.power2) << traits::mantissa_bits);
+    if (negative)
+        value |= static_cast<bits_type>(bits_type(1) << (sizeof(bits_type) * 8 - 1));
+
+    T result;
+    std::memcpy(&result, &value, sizeof(T));
+    return result;
+}
+} // namespace lexy::_detail
+
+//=== slow path ===//
+namespace lexy::_detail
+{
+// An arbitrary precision unsigned integer with enough capacity for the slow path.
+class float_bigint
+{
+public:
+    explicit float_bigint(std::uint64_t value) : _size(0)
+    {
+        for (; value != 0; value >>= 32)
+            _limbs[_size++] = static_cast<std::uint32_t>(value);
+    }
+
+    void mul_add(std::uint32_t factor, std::uint32_t summand)
+    {
+        auto carry = std::uint64_t(summand);
+        for (auto i = std::size_t(0); i != _size; ++i)
+        {
+            auto cur  = std::uint64_t(_limbs[i]) * factor + carry;
+            _limbs[i] = static_cast<std::uint32_t>(cur);
+            carry     = cur >> 32;
+        }
+        if (carry != 0)
+            _push_back(static_cast<std::uint32_t>(carry));
+    }
+
+    void mul_pow5(std::int64_t exponent)
+    {
+        // 5^13 is the biggest power of five that fits into 32 bits.
+        for (; exponent >= 13; exponent -= 13)
+            mul_add(1220703125u, 0);
+
+        auto remainder = std::uint32_t(1);
+        for (; exponent > 0; --exponent)
+            remainder *= 5;
+        mul_add(remainder, 0);
+    }
+
+    void shl(std::int64_t bits)
+    {
+        if (_size == 0)
+            return;
+
+        auto limb_shift = static_cast<std::size_t>(bits / 32);
+        auto bit_shift  = static_cast<unsigned>(bits % 32);
+
+        // Make room for the shifted limbs and a potential carry.
+        LEXY_PRECONDITION(_size + limb_shift + 1 <= capacity);
+        _limbs[_size + limb_shift] = 0;
+        for (auto i = _size; i != 0; --i)
+        {
+            auto cur = _limbs[i - 1];
+            if (bit_shift != 0)
+                _limbs[i + limb_shift] |= cur >> (32 - bit_shift);
+            _limbs[i - 1 + limb_shift] = cur << bit_shift;
+        }
+        for (auto i = std::size_t(0); i != limb_shift; ++i)
+            _limbs[i] = 0;
+
+        _size += limb_shift + 1;
+        if (_limbs[_size - 1] == 0)
+            --_size;
+    }
+
+    friend int compare(const float_bigint& lhs, const float_bigint& rhs)
+    {
+        if (lhs._size != rhs._size)
+            return lhs._size < rhs._size ? -1 : 1;
+
+        for (auto i = lhs._size; i != 0; --i)
+            if (lhs._limbs[i - 1] != rhs._limbs[i - 1])
+                return lhs._limbs[i - 1] < rhs._limbs[i - 1] ? -1 : 1;
+        return 0;
+    }
+
+private:
+    // Enough for the 769 digits of the slow path multiplied or divided by the exponent.
+    static constexpr std::size_t capacity = 160;
+
+    void _push_back(std::uint32_t limb)
+    {
+        LEXY_PRECONDITION(_size < capacity);
+        _limbs[_size++] = limb;
+    }
+
+    std::uint32_t _limbs[capacity];
+    std::size_t   _size;
+};
+
+// `bits` is the float closest to the truncated digits; the actual result is either `bits` or the
+// next float, so we compare the exact value with the halfway point between the two.
+template <typename T, typename Iterator>
+float_bits compute_float_slow(Iterator begin, Iterator end, float_bits bits)
+{
+    using traits = float_traits<T>;
+    if (bits.power2 == traits::infinite_power)
+        return bits;
+
+    // No double is ever exactly halfway between two doubles once more than 767 digits are taken
+    // into account, so we can replace all further digits by a single non-zero one.
+    constexpr auto max_digits = 768;
+
+    float_bigint digits(0);
+    auto         decimal
+        = scan_decimal_float(begin, end, max_digits, [&](unsigned d) { digits.mul_add(10, d); });
+    if (decimal.truncated)
+    {
+        digits.mul_add(10, 1);
+        --decimal.exponent;
+    }
+
+    // The halfway point is `(2 * mantissa + 1) * 2^(exponent - 1)`.
+    auto mantissa = bits.mantissa;
+    auto exponent = std::int64_t(1) - traits::mantissa_bits + traits::min_exponent;
+    if (bits.power2 != 0)
+    {
+        mantissa |= std::uint64_t(1) << traits::mantissa_bits;
+        exponent += bits.power2 - 1;
+    }
+    float_bigint halfway(2 * mantissa + 1);
+    exponent -= 1;
+
+    // We compare `digits * 5^decimal.exponent * 2^decimal.exponent` with
+    // `halfway * 2^exponent`, moving the power of five to the side where it is non-negative.
+    if (decimal.exponent >= 0)
+        digits.mul_pow5(decimal.exponent);
+    else
+        halfway.mul_pow5(-decimal.exponent);
+
+    auto shift = decimal.exponent - exponent;
+    if (shift >= 0)
+        digits.shl(shift);
+    else
+        halfway.shl(-shift);
+
+    auto cmp = compare(digits, halfway);
+    if (cmp > 0 || (cmp == 0 && (bits.mantissa & 1) != 0))
+    {
+        // Round up; this may carry into the exponent.
+        ++bits.mantissa;
+        if (bits.mantissa == (std::uint64_t(1) << traits::mantissa_bits))
+        {
+            bits.mantissa = 0;
+            ++bits.power2;
+        }
+    }
+    return bits;
+}
+} // namespace lexy::_detail
+
+namespace lexy::_detail
+{
+// Converts a number of the form `[sign] digits [. digits] [(e|E) [sign] digits]` into the
+// closest float.
+template <typename T, typename Iterator>
+T parse_float(Iterator begin, Iterator end)
+{
+    using traits = float_traits<T>;
+
+    auto w       = std::uint64_t(0);
+    auto decimal = scan_decimal_float(begin, end, 19, [&](unsigned d) { w = w * 10 + d; });
+
+    if (float_has_fast_path && !decimal.truncated
+        && decimal.exponent >= -traits::max_exponent_fast_path
+        && decimal.exponent <= traits::max_exponent_fast_path
+        && w <= traits::max_mantissa_fast_path)
+    {
+        // Both w and the power of ten are exactly representable, so a single operation gives the
+        // correctly rounded result.
+        auto value = static_cast<T>(w);
+        if (decimal.exponent < 0)
+            value = value / traits::exact_power_of_ten[-decimal.exponent];
+        else
+            value = value * traits::exact_power_of_ten[decimal.exponent];
+        return decimal.negative ? -value : value;
+    }
+
+    auto bits = compute_float<T>(decimal.exponent, w);
+    if (decimal.truncated && compute_float<T>(decimal.exponent, w + 1) != bits)
+        bits = compute_float_slow<T>(begin, end, bits);
+
+    return float_from_bits<T>(bits, decimal.negative);
+}
+} // namespace lexy::_detail
+
+#endif // LEXY_DETAIL_FLOAT_HPP_INCLUDED
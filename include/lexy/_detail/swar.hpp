@@ -71,6 +71,10 @@ constexpr swar_int swar_fill_compl(CharT _c)
     return result;
 }
 
+// The swar_int where the most significant bit of each char is set.
+template <typename CharT>
+constexpr auto swar_msb_mask = swar_fill_compl(CharT(uchar_t<CharT>(-1) >> 1));
+
 constexpr void _swar_pack(swar_int&, int) {}
 template <typename H, typename... T>
 constexpr void _swar_pack(swar_int& result, int index, H h, T... t)
@@ -128,6 +132,27 @@ constexpr auto swar_pack(CharT... cs)
     return result;
 }
 
+// Loads the next swar_length<CharT> chars starting at ptr into a swar_int.
+// Unlike the swar readers, it can be used during constant evaluation.
+template <typename CharT>
+constexpr swar_int swar_load(const CharT* ptr)
+{
+#if LEXY_IS_LITTLE_ENDIAN
+    if (!LEXY_IS_CONSTANT_EVALUATED())
+    {
+        // C++17 doesn't allow uninitialized variables in constexpr functions.
+        swar_int result = 0;
+        std::memcpy(&result, ptr, sizeof(swar_int));
+        return result;
+    }
+#endif
+
+    auto result = swar_int(0);
+    for (auto i = 0u; i != swar_length<CharT>; ++i)
+        result |= swar_int(make_uchar(ptr[i])) << (i * char_bit_size<CharT>);
+    return result;
+}
+
 // Returns the index of the char that is different between lhs and rhs.
 template <typename CharT>
 constexpr std::size_t swar_find_difference(swar_int lhs, swar_int rhs)
@@ -190,6 +215,53 @@ constexpr bool swar_has_char(swar_int v)
         return swar_has_zero<CharT>(v ^ mask);
     }
 }
+
+// Returns a swar_int where the most significant bit of a char is set if and only if the char is
+// zero. Unlike swar_has_zero(), it is exact for every char, not just the first one.
+template <typename CharT>
+constexpr swar_int swar_zero_mask(swar_int v)
+{
+    constexpr auto low_bits = swar_fill(CharT(uchar_t<CharT>(-1) >> 1));
+
+    // The most significant bit is set if any of the lower bits are set.
+    auto low_nonzero = (v & low_bits) + low_bits;
+    return ~(low_nonzero | v | low_bits);
+}
+
+// Returns a swar_int where the most significant bit of a char is set if it is equal to C.
+template <typename CharT, CharT C>
+constexpr swar_int swar_char_mask(swar_int v)
+{
+    constexpr auto mask = swar_fill(C);
+    return swar_zero_mask<CharT>(v ^ mask);
+}
+
+// Returns a swar_int where the most significant bit of a char is set if it is in [Lo, Hi].
+// Both bounds must be ASCII characters.
+template <typename CharT, int Lo, int Hi>
+constexpr swar_int swar_range_mask(swar_int v)
+{
+    static_assert(0 <= Lo && Lo <= Hi && Hi <= 0x7F);
+    constexpr auto ascii_msb = swar_fill(CharT(0x80));
+
+    // By adding an offset to the lower seven bits, the eighth bit is set if the char is >= Lo,
+    // or > Hi, respectively.
+    auto low         = v & swar_fill(CharT(0x7F));
+    auto not_less    = low + swar_fill(CharT(0x80 - Lo));
+    auto not_greater = ~(low + swar_fill(CharT(0x7F - Hi)));
+    auto in_range    = not_less & not_greater & ascii_msb;
+
+    // Move the result to the most significant bit and discard anything that wasn't ASCII.
+    auto is_ascii = swar_zero_mask<CharT>(v & swar_fill_compl(CharT(0x7F)));
+    return (in_range << (char_bit_size<CharT> - 8)) & is_ascii;
+}
+
+// Returns the index of the first char whose most significant bit is set in a non-zero mask.
+template <typename CharT>
+constexpr std::size_t swar_find_first(swar_int mask)
+{
+    return swar_find_difference<CharT>(mask, 0);
+}
 } // namespace lexy::_detail
 
 namespace lexy::_detail
@@ -236,6 +308,58 @@ public:
     }
 };
 
+// Whether the reader can read SWAR blocks as long as there are enough chars remaining.
+// Unlike a swar reader, it doesn't have padding at the end, so it has to switch to a tail loop.
+template <typename Reader>
+constexpr bool is_bounded_swar_reader = [] {
+    using char_type = typename Reader::encoding::char_type;
+    if constexpr (is_bulk_reader<Reader>)
+        return std::is_same_v<typename Reader::iterator, const char_type*>
+               && sizeof(char_type) < sizeof(swar_int);
+    else
+        return false;
+}();
+
+// Whether peek_swar() and bump_swar() can be used.
+template <typename Reader>
+constexpr bool has_swar = is_swar_reader<Reader> || is_bounded_swar_reader<Reader>;
+
+// Whether a SWAR block starting at the current position can be read.
+template <typename Reader>
+constexpr bool swar_available([[maybe_unused]] const Reader& reader)
+{
+    if constexpr (is_swar_reader<Reader>)
+        return true;
+    else
+        return reader.remaining() >= swar_length<typename Reader::encoding::char_type>;
+}
+
+template <typename Reader>
+constexpr swar_int peek_swar(const Reader& reader)
+{
+    if constexpr (is_swar_reader<Reader>)
+        return reader.peek_swar();
+    else
+        return swar_load(reader.position());
+}
+
+template <typename Reader>
+constexpr void bump_swar(Reader& reader)
+{
+    if constexpr (is_swar_reader<Reader>)
+        reader.bump_swar();
+    else
+        reader.advance(swar_length<typename Reader::encoding::char_type>);
+}
+template <typename Reader>
+constexpr void bump_swar(Reader& reader, std::size_t char_count)
+{
+    if constexpr (is_swar_reader<Reader>)
+        reader.bump_swar(char_count);
+    else
+        reader.advance(char_count);
+}
+
 constexpr std::size_t round_size_for_swar(std::size_t size_in_bytes)
 {
     // We round up to the next multiple.
@@ -198,8 +198,10 @@ namespace lexy
 {
 constexpr void* no_parse_state = nullptr;
 
-template <typename Handler, typename State, typename Production, typename Reader>
-constexpr auto _do_action(_pc<Handler, State, Production>& context, Reader& reader)
+template <typename Handler, typename State, typename Production, typename WhitespaceProduction,
+          typename Reader>
+constexpr auto _do_action(_pc<Handler, State, Production, WhitespaceProduction>& context,
+                          Reader&                                               reader)
 {
     context.on(parse_events::grammar_start{}, reader.position());
     context.on(parse_events::production_start{}, reader.position());
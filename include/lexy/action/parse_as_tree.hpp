@@ -9,11 +9,88 @@
 #include <lexy/dsl/any.hpp>
 #include <lexy/parse_tree.hpp>
 
+//=== node filters ===//
 namespace lexy
 {
-template <typename Tree, typename Reader>
+/// Keeps every node of the parse tree.
+struct keep_all_nodes
+{
+    template <typename TokenKind>
+    static constexpr bool keep_token(token_kind<TokenKind>) noexcept
+    {
+        return true;
+    }
+
+    static constexpr bool keep_production(production_info) noexcept
+    {
+        return true;
+    }
+};
+
+/// Does not add whitespace tokens to the parse tree.
+struct drop_whitespace_nodes : keep_all_nodes
+{
+    template <typename TokenKind>
+    static constexpr bool keep_token(token_kind<TokenKind> kind) noexcept
+    {
+        return kind != lexy::whitespace_token_kind;
+    }
+};
+
+/// Does not add tokens of the specified kinds to the parse tree.
+template <auto... Kinds>
+struct drop_token_nodes : keep_all_nodes
+{
+    template <typename TokenKind>
+    static constexpr bool keep_token(token_kind<TokenKind> kind) noexcept
+    {
+        return ((kind != token_kind<TokenKind>(Kinds)) && ...);
+    }
+};
+
+/// Does not add nodes for the specified productions to the parse tree.
+/// Their children are added to the parent node instead, as if they were transparent.
+template <typename... Productions>
+struct drop_production_nodes : keep_all_nodes
+{
+    static constexpr bool keep_production(production_info info) noexcept
+    {
+        return ((info != production_info(Productions{})) && ...);
+    }
+};
+
+/// Only keeps a node if all filters keep it.
+template <typename... Filters>
+struct combine_node_filters
+{
+    template <typename TokenKind>
+    static constexpr bool keep_token(token_kind<TokenKind> kind) noexcept
+    {
+        return (Filters::keep_token(kind) && ...);
+    }
+
+    static constexpr bool keep_production(production_info info) noexcept
+    {
+        return (Filters::keep_production(info) && ...);
+    }
+};
+
+template <typename Filter>
+using _detect_node_filter = decltype(Filter::keep_production(LEXY_DECLVAL(production_info)));
+template <typename Filter>
+constexpr bool _is_node_filter = _detail::is_detected<_detect_node_filter, Filter>;
+} // namespace lexy
+
+namespace lexy
+{
+template <typename Tree, typename Reader, typename Filter = keep_all_nodes>
 class _pth
 {
+    template <typename R, typename TokenKind, typename MemoryResource>
+    static auto _token_kind_of(const parse_tree<R, TokenKind, MemoryResource>*)
+        -> lexy::token_kind<TokenKind>;
+    using _token_kind = decltype(_token_kind_of(LEXY_DECLVAL(Tree*)));
+
 public:
     template <typename Input, typename Sink>
     explicit _pth(Tree& tree, const _detail::any_holder<const Input*>& input,
@@ -21,6 +98,15 @@ public:
     : _tree(&tree), _depth(0), _validate(input, sink)
     {}
 
+    // Appends the nodes of the parsed production to the current node of the builder instead.
+    template <typename Input, typename Sink>
+    explicit _pth(typename Tree::builder&& builder,
+                  const _detail::any_holder<const Input*>& input, _detail::any_holder<Sink>& sink)
+    : _tree(nullptr), _depth(1), _validate(input, sink)
+    {
+        _builder.emplace(LEXY_MOV(builder));
+    }
+
     class event_handler
     {
         using iterator = typename Reader::iterator;
@@ -30,12 +116,17 @@ public:
 
         void on(_pth& handler, parse_events::grammar_start, iterator)
         {
+            if (handler._tree == nullptr)
+                // We're appending to an existing builder.
+                return;
             LEXY_PRECONDITION(handler._depth == 0);
 
             handler._builder.emplace(LEXY_MOV(*handler._tree), _validate.get_info());
         }
         void on(_pth& handler, parse_events::grammar_finish, Reader& reader)
         {
+            if (handler._tree == nullptr)
+                return;
             LEXY_PRECONDITION(handler._depth == 0);
 
             auto begin = reader.position();
@@ -46,6 +137,8 @@ public:
         }
         void on(_pth& handler, parse_events::grammar_cancel, Reader&)
         {
+            if (handler._tree == nullptr)
+                return;
             LEXY_PRECONDITION(handler._depth == 0);
 
             handler._tree->clear();
@@ -54,7 +147,14 @@ public:
         void on(_pth& handler, parse_events::production_start ev, iterator pos)
         {
             if (handler._depth++ > 0)
-                _marker = handler._builder->start_production(_validate.get_info());
+            {
+                auto info = _validate.get_info();
+                if (!Filter::keep_production(info))
+                    // We don't want a node, so treat it like a transparent production.
+                    info.is_transparent = true;
+
+                _marker = handler._builder->start_production(info);
+            }
 
             _validate.on(handler._validate, ev, pos);
         }
@@ -109,7 +209,13 @@ public:
         template <typename TokenKind>
         void on(_pth& handler, parse_events::token, TokenKind kind, iterator begin, iterator end)
         {
-            handler._builder->token(kind, begin, end);
+            if (Filter::keep_token(_token_kind(kind)))
+                handler._builder->token(kind, begin, end);
+            else if (handler._builder->current_child_count() == 0
+                     && !(_token_kind(kind).ignore_if_empty() && begin == end))
+                // The position of a production is the position of its first token,
+                // so we need to remember where the dropped token was.
+                handler._builder->token(lexy::position_token_kind, begin, begin);
         }
 
         template <typename Error>
@@ -135,10 +241,17 @@ public:
     template <typename T>
     constexpr auto get_result(bool rule_parse_result) &&
     {
-        LEXY_PRECONDITION(_depth == 0);
+        LEXY_PRECONDITION(_depth == (_tree == nullptr ? 1 : 0));
         return LEXY_MOV(_validate).template get_result<T>(rule_parse_result);
     }
 
+    // Returns the builder that was passed to the constructor.
+    typename Tree::builder&& release_builder() && noexcept
+    {
+        LEXY_PRECONDITION(_tree == nullptr);
+        return LEXY_MOV(*_builder);
+    }
+
 private:
     lexy::_detail::lazy_init<typename Tree::builder> _builder;
     Tree*                                            _tree;
@@ -148,7 +261,7 @@ private:
 };
 
 template <typename State, typename Input, typename ErrorCallback, typename TokenKind = void,
-          typename MemoryResource = void>
+          typename MemoryResource = void, typename Filter = keep_all_nodes>
 struct parse_as_tree_action
 {
     using tree_type = lexy::parse_tree_for<Input, TokenKind, MemoryResource>;
@@ -157,7 +270,7 @@ struct parse_as_tree_action
     const ErrorCallback* _callback;
     State*               _state = nullptr;
 
-    using handler = _pth<tree_type, lexy::input_reader<Input>>;
+    using handler = _pth<tree_type, lexy::input_reader<Input>, Filter>;
     using state   = State;
     using input   = Input;
 
@@ -186,8 +299,7 @@ struct parse_as_tree_action
 
 template <typename Production, typename TokenKind, typename MemoryResource, typename Input,
           typename ErrorCallback>
-auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
-                   const Input&                                                      input,
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree, const Input& input,
                    const ErrorCallback& callback) -> validate_result<ErrorCallback>
 {
     return parse_as_tree_action<void, Input, ErrorCallback, TokenKind,
@@ -195,7 +307,7 @@ auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResour
 }
 template <typename Production, typename TokenKind, typename MemoryResource, typename Input,
           typename State, typename ErrorCallback>
-auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree,
                    const Input& input, State& state,
                    const ErrorCallback& callback) -> validate_result<ErrorCallback>
 {
@@ -204,13 +316,43 @@ auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResour
 }
 template <typename Production, typename TokenKind, typename MemoryResource, typename Input,
           typename State, typename ErrorCallback>
-auto parse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree,
                    const Input& input, const State& state,
                    const ErrorCallback& callback) -> validate_result<ErrorCallback>
 {
     return parse_as_tree_action<const State, Input, ErrorCallback, TokenKind,
                                 MemoryResource>(state, tree, callback)(Production{}, input);
 }
+
+template <typename Production, typename Filter, typename TokenKind, typename MemoryResource,
+          typename Input, typename ErrorCallback,
+          typename = std::enable_if_t<_is_node_filter<Filter>>>
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree, const Input& input,
+                   const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return parse_as_tree_action<void, Input, ErrorCallback, TokenKind, MemoryResource,
+                                Filter>(tree, callback)(Production{}, input);
+}
+template <typename Production, typename Filter, typename TokenKind, typename MemoryResource,
+          typename Input, typename State, typename ErrorCallback,
+          typename = std::enable_if_t<_is_node_filter<Filter>>>
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree,
+                   const Input& input, State& state,
+                   const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return parse_as_tree_action<State, Input, ErrorCallback, TokenKind, MemoryResource,
+                                Filter>(state, tree, callback)(Production{}, input);
+}
+template <typename Production, typename Filter, typename TokenKind, typename MemoryResource,
+          typename Input, typename State, typename ErrorCallback,
+          typename = std::enable_if_t<_is_node_filter<Filter>>>
+auto parse_as_tree(parse_tree_for<Input, TokenKind, MemoryResource>& tree,
+                   const Input& input, const State& state,
+                   const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return parse_as_tree_action<const State, Input, ErrorCallback, TokenKind, MemoryResource,
+                                Filter>(state, tree, callback)(Production{}, input);
+}
 } // namespace lexy
 
 #endif // LEXY_ACTION_PARSE_AS_TREE_HPP_INCLUDED
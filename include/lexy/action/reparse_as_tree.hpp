@@ -0,0 +1,293 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_ACTION_REPARSE_AS_TREE_HPP_INCLUDED
+#define LEXY_ACTION_REPARSE_AS_TREE_HPP_INCLUDED
+
+#include <lexy/action/parse_as_tree.hpp>
+
+namespace lexy
+{
+/// Describes a change of the input:
+/// `removed_length` code units starting at `offset` were replaced by `inserted_length` code units.
+struct text_edit
+{
+    std::size_t offset;
+    std::size_t removed_length;
+    std::size_t inserted_length;
+};
+
+template <typename Tree, typename Input>
+class _reparse_tree
+{
+    using reader   = lexy::input_reader<Input>;
+    using iterator = typename reader::iterator;
+    using node     = typename Tree::node;
+    using builder  = typename Tree::builder;
+
+public:
+    explicit _reparse_tree(const Tree& old_tree, const Input& input, text_edit edit)
+    : _old_tree(&old_tree), _old_begin(old_tree.root().position()), _input(&input),
+      _begin(input.reader().position()), _edit(edit)
+    {}
+
+    // Returns the smallest node of one of the productions that contains the edit.
+    template <typename... RestartProductions>
+    bool find_restart_node()
+    {
+        // If the old tree contains errors, we can't reuse it:
+        // we would lose the errors in the parts that we don't parse again.
+        for (auto [event, n] : _old_tree->traverse())
+            if (n.kind().is_token() && n.token().kind() == lexy::error_token_kind)
+                return false;
+
+        auto edit_begin = _edit.offset;
+        auto edit_end   = _edit.offset + _edit.removed_length;
+
+        auto found = false;
+        auto cur   = _old_tree->root();
+        for (auto descend = true; descend;)
+        {
+            descend = false;
+            for (auto child : cur.children())
+            {
+                if (!child.kind().is_production())
+                    continue;
+
+                auto lexeme = child.covering_lexeme();
+                auto begin  = _old_offset(lexeme.begin());
+                auto end    = _old_offset(lexeme.end());
+                if (edit_end < begin)
+                    // All following children start after the edit.
+                    break;
+                else if (begin <= edit_begin && edit_end <= end)
+                {
+                    // The child contains the edit, so continue with it.
+                    cur = child;
+
+                    // We can only restart at it, if the edit is strictly inside,
+                    // otherwise the neighbors could be affected as well.
+                    if (((child.kind() == production_info(RestartProductions{})) || ...)
+                        && begin < edit_begin && edit_end < end)
+                    {
+                        _restart_node = child;
+                        found         = true;
+                    }
+
+                    // A restart production is parsed as a child of the root production,
+                    // so we can't restart below a production that changes the whitespace.
+                    descend = !child.kind().is_token_production()
+                              && !child.kind().defines_whitespace();
+                    break;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    // Builds a new tree by copying the old one and reparsing the restart node.
+    // Returns false, if reparsing didn't produce the same production at the same place.
+    template <typename Production, typename... RestartProductions, typename State>
+    bool build(Tree& tree, State* state)
+    {
+        builder b(LEXY_MOV(tree), production_info(Production{}));
+
+        auto success = true;
+        for (auto child : _old_tree->root().children())
+            if (!_copy<Production, RestartProductions...>(b, child, state))
+            {
+                success = false;
+                break;
+            }
+
+        auto remaining = _old_tree->remaining_input();
+        tree = LEXY_MOV(b).finish({_translate(remaining.begin()), _translate(remaining.end())});
+        return success;
+    }
+
+private:
+    std::size_t _old_offset(iterator pos) const noexcept
+    {
+        return std::size_t(pos - _old_begin);
+    }
+
+    iterator _translate(iterator old_pos) const noexcept
+    {
+        auto offset = _old_offset(old_pos);
+        if (offset < _edit.offset)
+            // Positions before the edit don't change.
+            return _begin + offset;
+        else
+            // Positions after the edit are shifted.
+            return _begin + (offset - _edit.removed_length + _edit.inserted_length);
+    }
+
+    template <typename Production, typename... RestartProductions, typename State>
+    bool _copy(builder& b, node n, State* state)
+    {
+        if (n.kind().is_token())
+        {
+            auto token = n.token();
+            b.token(token.kind(), _translate(token.lexeme().begin()),
+                    _translate(token.lexeme().end()));
+            return true;
+        }
+        else if (n == _restart_node)
+        {
+            auto result = false;
+            (void)((n.kind() == production_info(RestartProductions{})
+                    && (result = _reparse<Production, RestartProductions>(b, n, state), true))
+                   || ...);
+            return result;
+        }
+        else
+        {
+            auto marker = b.start_production(n.kind());
+            for (auto child : n.children())
+                if (!_copy<Production, RestartProductions...>(b, child, state))
+                    return false;
+            b.finish_production(LEXY_MOV(marker));
+            return true;
+        }
+    }
+
+    template <typename Production, typename RestartProduction, typename State>
+    bool _reparse(builder& b, node n, State* state)
+    {
+        auto lexeme = n.covering_lexeme();
+        auto begin  = _translate(lexeme.begin());
+        auto end    = _translate(lexeme.end());
+
+        // We're only interested in whether it succeeds, so we just count errors.
+        _detail::any_holder input_holder(static_cast<const Input*>(_input));
+        _detail::any_holder sink(_get_error_sink(lexy::noop));
+        using handler = _pth<Tree, reader>;
+
+        _detail::parse_context_control_block control_block(handler(LEXY_MOV(b), input_holder,
+                                                                   sink),
+                                                           state,
+                                                           max_recursion_depth<Production>());
+        // We parse the production as if it were a child of the root production;
+        // find_restart_node() ensures that it uses the same whitespace.
+        _pc<handler, State, Production> root_context(&control_block);
+        auto                            context = root_context.sub_context(RestartProduction{});
+
+        auto reader = _input->reader();
+        reader.reset({begin});
+        auto rule_result = _do_action(context, reader);
+
+        auto result = LEXY_MOV(control_block.parse_handler)
+                          .template get_result<validate_result<_noop>>(rule_result);
+        b = LEXY_MOV(control_block.parse_handler).release_builder();
+
+        // We need to end exactly where the old production ended,
+        // otherwise the remaining nodes don't fit anymore.
+        return result.is_success() && reader.position() == end;
+    }
+
+    const Tree* _old_tree;
+    iterator    _old_begin;
+
+    const Input* _input;
+    iterator     _begin;
+
+    text_edit _edit;
+    node      _restart_node = _old_tree->root();
+};
+
+template <typename Production, typename... RestartProductions, typename State, typename Input,
+          typename TokenKind, typename MemoryResource, typename ErrorCallback>
+auto _do_reparse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+                         const parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>&
+                                              old_tree,
+                         const Input& input, State* state, text_edit edit,
+                         const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    using tree_type = parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>;
+    static_assert(_detail::is_random_access_iterator<typename lexy::input_reader<Input>::iterator>,
+                  "reparsing requires random access iterators");
+    LEXY_PRECONDITION(&tree != &old_tree);
+
+    // Without any children, we don't know where the old input began,
+    // but there is nothing worth reusing anyway.
+    if (!old_tree.empty() && !old_tree.root().children().empty())
+    {
+        _reparse_tree<tree_type, Input> reparse(old_tree, input, edit);
+        auto success = false;
+        if (reparse.template find_restart_node<RestartProductions...>())
+        {
+            if constexpr (std::is_void_v<State> || std::is_const_v<State>
+                          || !std::is_copy_constructible_v<State>
+                          || !std::is_copy_assignable_v<State>)
+            {
+                success = reparse.template build<Production, RestartProductions...>(tree, state);
+            }
+            else
+            {
+                // We parse into a copy of the state,
+                // so the effects of a reparse that doesn't fit are discarded.
+                auto scratch = *state;
+                success = reparse.template build<Production, RestartProductions...>(tree, &scratch);
+                if (success)
+                    *state = LEXY_MOV(scratch);
+            }
+        }
+
+        if (success)
+        {
+            // We've successfully reparsed without any errors.
+            _detail::any_holder           input_holder(&input);
+            _detail::any_holder           sink(_get_error_sink(callback));
+            _vh<lexy::input_reader<Input>> handler(input_holder, sink);
+            return LEXY_MOV(handler).template get_result<validate_result<ErrorCallback>>(true);
+        }
+    }
+
+    // We have to parse everything again.
+    using action
+        = parse_as_tree_action<State, Input, ErrorCallback, TokenKind, MemoryResource>;
+    if constexpr (std::is_void_v<State>)
+        return action(tree, callback)(Production{}, input);
+    else
+        return action(*state, tree, callback)(Production{}, input);
+}
+
+/// Parses the edited `input` into `tree`, reusing the unchanged parts of `old_tree`.
+template <typename Production, typename... RestartProductions, typename Input, typename TokenKind,
+          typename MemoryResource, typename ErrorCallback>
+auto reparse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+                     const parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>&
+                                  old_tree,
+                     const Input& input, text_edit edit,
+                     const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return _do_reparse_as_tree<Production, RestartProductions...>(tree, old_tree, input,
+                                                                  static_cast<void*>(nullptr),
+                                                                  edit, callback);
+}
+template <typename Production, typename... RestartProductions, typename Input, typename TokenKind,
+          typename MemoryResource, typename State, typename ErrorCallback>
+auto reparse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+                     const parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>&
+                                  old_tree,
+                     const Input& input, State& state, text_edit edit,
+                     const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return _do_reparse_as_tree<Production, RestartProductions...>(tree, old_tree, input, &state,
+                                                                  edit, callback);
+}
+template <typename Production, typename... RestartProductions, typename Input, typename TokenKind,
+          typename MemoryResource, typename State, typename ErrorCallback>
+auto reparse_as_tree(parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>& tree,
+                     const parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>&
+                                  old_tree,
+                     const Input& input, const State& state, text_edit edit,
+                     const ErrorCallback& callback) -> validate_result<ErrorCallback>
+{
+    return _do_reparse_as_tree<Production, RestartProductions...>(tree, old_tree, input, &state,
+                                                                  edit, callback);
+}
+} // namespace lexy
+
+#endif // LEXY_ACTION_REPARSE_AS_TREE_HPP_INCLUDED
@@ -0,0 +1,165 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_ACTION_TOKENIZE_HPP_INCLUDED
+#define LEXY_ACTION_TOKENIZE_HPP_INCLUDED
+
+#include <lexy/action/base.hpp>
+#include <lexy/token.hpp>
+#include <new>
+
+namespace lexy
+{
+template <typename Reader, typename TokenKind, typename Sink>
+class _tkh
+{
+public:
+    using token = lexy::token<Reader, TokenKind>;
+
+    // Enough to amortize the sink call, small enough to stay in the cache.
+    static constexpr std::size_t batch_size = 256;
+
+    explicit _tkh(Sink& sink) : _sink(&sink), _size(0), _failed(false) {}
+
+    class event_handler
+    {
+        using iterator = typename Reader::iterator;
+
+    public:
+        constexpr event_handler(production_info) {}
+
+        void on(_tkh& handler, parse_events::grammar_finish, Reader&)
+        {
+            handler._flush();
+        }
+        void on(_tkh& handler, parse_events::grammar_cancel, Reader&)
+        {
+            handler._flush();
+        }
+
+        template <typename Kind>
+        void on(_tkh& handler, parse_events::token, Kind kind, iterator begin, iterator end)
+        {
+            handler._push(kind, begin, end);
+        }
+
+        template <typename Error>
+        constexpr void on(_tkh& handler, parse_events::error, Error&&)
+        {
+            handler._failed = true;
+        }
+
+        template <typename Event, typename... Args>
+        constexpr int on(_tkh&, Event, const Args&...)
+        {
+            return 0; // operation_chain_start needs to return something
+        }
+    };
+
+    template <typename Production, typename State>
+    using value_callback = _detail::void_value_callback;
+
+    template <typename>
+    constexpr bool get_result(bool rule_parse_result) &&
+    {
+        return rule_parse_result && !_failed;
+    }
+
+private:
+    token* _data() noexcept
+    {
+        // NOLINTNEXTLINE: We've created the tokens in the storage.
+        return std::launder(reinterpret_cast<token*>(_storage));
+    }
+
+    template <typename Kind>
+    void _push(Kind _kind, typename Reader::iterator begin, typename Reader::iterator end)
+    {
+        // We report the same tokens as the parse tree.
+        auto kind = token_kind<TokenKind>(_kind);
+        if (kind.ignore_if_empty() && begin == end)
+            return;
+
+        if (kind == lexy::error_token_kind && _size > 0
+            && _data()[_size - 1].kind() == lexy::error_token_kind)
+        {
+            // We merge error tokens by replacing the previous one.
+            begin = _data()[_size - 1].lexeme().begin();
+            --_size;
+        }
+        else if (_size == batch_size)
+        {
+            _flush();
+        }
+
+        // token is trivially destructible, so we don't need to destroy old ones.
+        auto memory = static_cast<void*>(_storage + _size * sizeof(token));
+        ::new (memory) token(kind, begin, end);
+        ++_size;
+    }
+
+    void _flush()
+    {
+        if (_size == 0)
+            return;
+
+        (*_sink)(static_cast<const token*>(_data()), _size);
+        _size = 0;
+    }
+
+    Sink*       _sink;
+    std::size_t _size;
+    bool        _failed;
+    alignas(token) unsigned char _storage[batch_size * sizeof(token)];
+};
+
+template <typename State, typename Input, typename Sink, typename TokenKind = void>
+struct tokenize_action
+{
+    Sink*  _sink;
+    State* _state = nullptr;
+
+    using handler = _tkh<lexy::input_reader<Input>, TokenKind, Sink>;
+    using state   = State;
+    using input   = Input;
+
+    template <typename>
+    using result_type = bool;
+
+    constexpr explicit tokenize_action(Sink& sink) : _sink(&sink) {}
+    template <typename U = State>
+    constexpr explicit tokenize_action(U& state, Sink& sink) : _sink(&sink), _state(&state)
+    {}
+
+    template <typename Production>
+    constexpr auto operator()(Production, const Input& input) const
+    {
+        auto reader = input.reader();
+        return lexy::do_action<Production, result_type>(handler(*_sink), _state, reader);
+    }
+};
+
+template <typename Production, typename TokenKind = void, typename Input, typename Sink>
+bool tokenize(const Input& input, Sink&& sink)
+{
+    return tokenize_action<void, Input, std::remove_reference_t<Sink>, TokenKind>(sink)(
+        Production{}, input);
+}
+template <typename Production, typename TokenKind = void, typename Input, typename State,
+          typename Sink>
+bool tokenize(const Input& input, State& state, Sink&& sink)
+{
+    return tokenize_action<State, Input, std::remove_reference_t<Sink>, TokenKind>(state, sink)(
+        Production{}, input);
+}
+template <typename Production, typename TokenKind = void, typename Input, typename State,
+          typename Sink>
+bool tokenize(const Input& input, const State& state, Sink&& sink)
+{
+    return tokenize_action<const State, Input, std::remove_reference_t<Sink>, TokenKind>(state,
+                                                                                         sink)(
+        Production{}, input);
+}
+} // namespace lexy
+
+#endif // LEXY_ACTION_TOKENIZE_HPP_INCLUDED
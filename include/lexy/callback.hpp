@@ -6,6 +6,7 @@
 
 #include <lexy/callback/adapter.hpp>
 #include <lexy/callback/aggregate.hpp>
+#include <lexy/callback/arena.hpp>
 #include <lexy/callback/base.hpp>
 #include <lexy/callback/bind.hpp>
 #include <lexy/callback/bit_cast.hpp>
@@ -15,6 +16,8 @@
 #include <lexy/callback/fold.hpp>
 #include <lexy/callback/forward.hpp>
 #include <lexy/callback/integer.hpp>
+#include <lexy/callback/intern.hpp>
+#include <lexy/callback/lazy.hpp>
 #include <lexy/callback/noop.hpp>
 #include <lexy/callback/object.hpp>
 #include <lexy/callback/string.hpp>
@@ -0,0 +1,185 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_CALLBACK_ARENA_HPP_INCLUDED
+#define LEXY_CALLBACK_ARENA_HPP_INCLUDED
+
+#include <cstdint>
+#include <lexy/_detail/memory_resource.hpp>
+#include <lexy/callback/base.hpp>
+
+namespace lexy
+{
+/// A monotonic memory resource: deallocation is a no-op and all memory is released at once.
+template <typename MemoryResource = void>
+class arena
+{
+    using resource_ptr = _detail::memory_resource_ptr<MemoryResource>;
+
+    static constexpr std::size_t initial_block_size = 4096;
+    static constexpr std::size_t max_block_size     = 1024 * 1024;
+
+    struct block
+    {
+        block*      next;
+        std::size_t size;
+
+        unsigned char* memory() noexcept
+        {
+            return reinterpret_cast<unsigned char*>(this) + sizeof(block);
+        }
+        unsigned char* end() noexcept
+        {
+            return reinterpret_cast<unsigned char*>(this) + size;
+        }
+    };
+
+public:
+    //=== constructors/destructors/assignment ===//
+    arena() : arena(_detail::get_memory_resource<MemoryResource>()) {}
+    explicit arena(MemoryResource* resource) noexcept
+    : _resource(resource), _head(nullptr), _cur_pos(nullptr), _cur_end(nullptr),
+      _next_block_size(initial_block_size)
+    {}
+
+    // Allocators store a pointer to the arena, so it can't be moved.
+    arena(const arena&)            = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena() noexcept
+    {
+        release();
+    }
+
+    //=== allocation ===//
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        auto memory = _align(_cur_pos, alignment);
+        if (memory == nullptr || memory > _cur_end || std::size_t(_cur_end - memory) < bytes)
+        {
+            if (sizeof(block) + bytes + alignment > _next_block_size)
+                // It doesn't fit into a regular block, so it gets a dedicated one.
+                // That way, we can continue using the rest of the current block.
+                return _align(_allocate_dedicated_block(bytes + alignment)->memory(), alignment);
+
+            _allocate_block();
+            memory = _align(_cur_pos, alignment);
+        }
+
+        _cur_pos = memory + bytes;
+        return memory;
+    }
+
+    // Memory is only released once the arena is destroyed.
+    void deallocate(void*, std::size_t, std::size_t) noexcept {}
+
+    /// Releases all memory allocated by the arena.
+    void release() noexcept
+    {
+        auto cur = _head;
+        while (cur != nullptr)
+        {
+            auto next = cur->next;
+            _resource->deallocate(cur, cur->size, alignof(block));
+            cur = next;
+        }
+
+        _head    = nullptr;
+        _cur_pos = _cur_end = nullptr;
+
+        _next_block_size = initial_block_size;
+    }
+
+    friend bool operator==(const arena& lhs, const arena& rhs) noexcept
+    {
+        return &lhs == &rhs;
+    }
+    friend bool operator!=(const arena& lhs, const arena& rhs) noexcept
+    {
+        return &lhs != &rhs;
+    }
+
+private:
+    static unsigned char* _align(unsigned char* ptr, std::size_t alignment) noexcept
+    {
+        if (ptr == nullptr)
+            return nullptr;
+
+        auto misaligned = reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1);
+        return misaligned == 0 ? ptr : ptr + (alignment - misaligned);
+    }
+
+    void _allocate_block()
+    {
+        auto memory = _resource->allocate(_next_block_size, alignof(block));
+        auto ptr    = ::new (memory) block{_head, _next_block_size};
+
+        _head    = ptr;
+        _cur_pos = ptr->memory();
+        _cur_end = ptr->end();
+
+        // Grow the blocks geometrically, so the number of blocks is logarithmic.
+        if (_next_block_size < max_block_size)
+            _next_block_size *= 2;
+    }
+
+    block* _allocate_dedicated_block(std::size_t min_size)
+    {
+        auto size   = sizeof(block) + min_size;
+        auto memory = _resource->allocate(size, alignof(block));
+        if (_head == nullptr)
+            return _head = ::new (memory) block{nullptr, size};
+
+        // Insert it after the current block, which remains the current one.
+        auto ptr    = ::new (memory) block{_head->next, size};
+        _head->next = ptr;
+        return ptr;
+    }
+
+    LEXY_EMPTY_MEMBER resource_ptr _resource;
+    block*                         _head;
+    unsigned char*                 _cur_pos;
+    unsigned char*                 _cur_end;
+    std::size_t                    _next_block_size;
+};
+
+/// An allocator that allocates from an arena.
+template <typename T, typename MemoryResource = void>
+class arena_allocator
+{
+public:
+    using value_type = T;
+
+    // Implicit, so containers can be constructed from the arena directly.
+    constexpr arena_allocator(arena<MemoryResource>& arena) noexcept : _arena(&arena) {}
+    template <typename U>
+    constexpr arena_allocator(const arena_allocator<U, MemoryResource>& other) noexcept
+    : _arena(&other.get_arena())
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, std::size_t) noexcept {}
+
+    constexpr arena<MemoryResource>& get_arena() const noexcept
+    {
+        return *_arena;
+    }
+
+    friend constexpr bool operator==(arena_allocator lhs, arena_allocator rhs) noexcept
+    {
+        return lhs._arena == rhs._arena;
+    }
+    friend constexpr bool operator!=(arena_allocator lhs, arena_allocator rhs) noexcept
+    {
+        return lhs._arena != rhs._arena;
+    }
+
+private:
+    arena<MemoryResource>* _arena;
+};
+} // namespace lexy
+
+#endif // LEXY_CALLBACK_ARENA_HPP_INCLUDED
@@ -48,6 +48,11 @@ template <typename T, typename... Args>
 using _detect_sink = decltype(LEXY_DECLVAL(const T).sink(LEXY_DECLVAL(Args)...).finish());
 template <typename T, typename... Args>
 constexpr bool is_sink = _detail::is_detected<_detect_sink, T, Args...>;
+
+template <typename T>
+using _detect_reserve = decltype(LEXY_DECLVAL(T&).reserve(std::size_t()));
+template <typename T>
+constexpr auto _has_reserve = _detail::is_detected<_detect_reserve, T>;
 } // namespace lexy
 
 namespace lexy
@@ -10,11 +10,6 @@ namespace lexy
 {
 struct nullopt;
 
-template <typename Container>
-using _detect_reserve = decltype(LEXY_DECLVAL(Container&).reserve(std::size_t()));
-template <typename Container>
-constexpr auto _has_reserve = _detail::is_detected<_detect_reserve, Container>;
-
 template <typename Container>
 using _detect_append = decltype(LEXY_DECLVAL(Container&).append(LEXY_DECLVAL(Container&&)));
 template <typename Container>
@@ -44,6 +39,13 @@ struct _list_sink
         return _result.emplace_back(LEXY_FWD(args)...);
     }
 
+    // Called by rules that know how many items there will be, e.g. `dsl::repeat`.
+    template <typename C = Container>
+    constexpr auto reserve(std::size_t size) -> decltype(LEXY_DECLVAL(C&).reserve(size))
+    {
+        return _result.reserve(size);
+    }
+
     constexpr Container&& finish() &&
     {
         return LEXY_MOV(_result);
@@ -184,6 +186,12 @@ struct _collection_sink
         return _result.emplace(LEXY_FWD(args)...);
     }
 
+    template <typename C = Container>
+    constexpr auto reserve(std::size_t size) -> decltype(LEXY_DECLVAL(C&).reserve(size))
+    {
+        return _result.reserve(size);
+    }
+
     constexpr Container&& finish() &&
     {
         return LEXY_MOV(_result);
@@ -429,6 +437,12 @@ public:
         _result.push_back(_callback(LEXY_FWD(args)...));
     }
 
+    template <typename C = Container>
+    constexpr auto reserve(std::size_t size) -> decltype(LEXY_DECLVAL(C&).reserve(size))
+    {
+        return _result.reserve(size);
+    }
+
     constexpr auto finish() &&
     {
         return LEXY_MOV(_result);
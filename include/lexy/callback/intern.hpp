@@ -0,0 +1,248 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_CALLBACK_INTERN_HPP_INCLUDED
+#define LEXY_CALLBACK_INTERN_HPP_INCLUDED
+
+#include <lexy/_detail/memory_resource.hpp>
+#include <lexy/callback/arena.hpp>
+#include <lexy/callback/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// A handle to a string stored in an intern table.
+template <typename CharT>
+class interned_string
+{
+public:
+    using char_type = CharT;
+
+    /// Creates a null handle.
+    constexpr interned_string() noexcept : _data(nullptr), _size(0) {}
+    constexpr explicit interned_string(const CharT* data, std::size_t size) noexcept
+    : _data(data), _size(size)
+    {}
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return _data != nullptr;
+    }
+
+    /// The string is null-terminated.
+    constexpr const CharT* c_str() const noexcept
+    {
+        return _data;
+    }
+    constexpr const CharT* data() const noexcept
+    {
+        return _data;
+    }
+    constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    // As strings are only stored once, we can compare the pointers.
+    friend constexpr bool operator==(interned_string lhs, interned_string rhs) noexcept
+    {
+        return lhs._data == rhs._data;
+    }
+    friend constexpr bool operator!=(interned_string lhs, interned_string rhs) noexcept
+    {
+        return lhs._data != rhs._data;
+    }
+
+private:
+    const CharT* _data;
+    std::size_t  _size;
+};
+
+/// Stores each distinct string only once.
+template <typename CharT, typename MemoryResource = void>
+class intern_table
+{
+    using resource_ptr = _detail::memory_resource_ptr<MemoryResource>;
+
+    static constexpr std::size_t initial_capacity = 64;
+
+    struct slot
+    {
+        const CharT* data; // nullptr if empty
+        std::size_t  size;
+        std::size_t  hash;
+    };
+
+public:
+    using char_type = CharT;
+    using handle    = interned_string<CharT>;
+
+    //=== constructors/destructors/assignment ===//
+    intern_table() : intern_table(_detail::get_memory_resource<MemoryResource>()) {}
+    explicit intern_table(MemoryResource* resource) noexcept
+    : _resource(resource), _strings(resource), _slots(nullptr), _capacity(0), _size(0)
+    {}
+
+    intern_table(const intern_table&)            = delete;
+    intern_table& operator=(const intern_table&) = delete;
+
+    ~intern_table() noexcept
+    {
+        if (_slots != nullptr)
+            _resource->deallocate(_slots, _capacity * sizeof(slot), alignof(slot));
+    }
+
+    //=== access ===//
+    std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    //=== interning ===//
+    /// FNV-1a hash of the string.
+    static constexpr std::size_t hash(const CharT* str, std::size_t size) noexcept
+    {
+        constexpr auto is_64bit = sizeof(std::size_t) == 8;
+        auto result = std::size_t(is_64bit ? 0xcbf2'9ce4'8422'2325ull : 0x811c'9dc5u);
+        for (auto i = std::size_t(0); i != size; ++i)
+        {
+            result ^= static_cast<std::size_t>(str[i]);
+            result *= std::size_t(is_64bit ? 0x0000'0100'0000'01b3ull : 0x0100'0193u);
+        }
+        return result;
+    }
+
+    handle intern(const CharT* str, std::size_t size)
+    {
+        return intern(str, size, hash(str, size));
+    }
+    /// Same as above, but with a precomputed `hash(str, size)`.
+    handle intern(const CharT* str, std::size_t size, std::size_t hash)
+    {
+        // We keep the load factor below 3/4.
+        if (4 * (_size + 1) > 3 * _capacity)
+            _rehash(_capacity == 0 ? initial_capacity : 2 * _capacity);
+
+        auto cur = _find(_slots, _capacity, str, size, hash);
+        if (cur->data == nullptr)
+        {
+            auto memory = static_cast<CharT*>(
+                _strings.allocate((size + 1) * sizeof(CharT), alignof(CharT)));
+            for (auto i = std::size_t(0); i != size; ++i)
+                memory[i] = str[i];
+            memory[size] = CharT();
+
+            *cur = slot{memory, size, hash};
+            ++_size;
+        }
+
+        return handle(cur->data, cur->size);
+    }
+
+private:
+    // Returns the slot containing the string, or the empty slot where it needs to be inserted.
+    static slot* _find(slot* slots, std::size_t capacity, const CharT* str, std::size_t size,
+                       std::size_t hash) noexcept
+    {
+        // capacity is a power of two, so we can use it as mask.
+        for (auto idx = hash & (capacity - 1); true; idx = (idx + 1) & (capacity - 1))
+        {
+            auto cur = &slots[idx];
+            if (cur->data == nullptr)
+                return cur;
+            else if (cur->hash == hash && cur->size == size && _equal(cur->data, str, size))
+                return cur;
+        }
+    }
+
+    static bool _equal(const CharT* lhs, const CharT* rhs, std::size_t size) noexcept
+    {
+        for (auto i = std::size_t(0); i != size; ++i)
+            if (lhs[i] != rhs[i])
+                return false;
+        return true;
+    }
+
+    void _rehash(std::size_t new_capacity)
+    {
+        auto memory    = _resource->allocate(new_capacity * sizeof(slot), alignof(slot));
+        auto new_slots = static_cast<slot*>(memory);
+        for (auto i = std::size_t(0); i != new_capacity; ++i)
+            ::new (static_cast<void*>(new_slots + i)) slot{nullptr, 0, 0};
+
+        for (auto i = std::size_t(0); i != _capacity; ++i)
+            if (_slots[i].data != nullptr)
+                *_find(new_slots, new_capacity, _slots[i].data, _slots[i].size, _slots[i].hash)
+                    = _slots[i];
+
+        if (_slots != nullptr)
+            _resource->deallocate(_slots, _capacity * sizeof(slot), alignof(slot));
+        _slots    = new_slots;
+        _capacity = new_capacity;
+    }
+
+    LEXY_EMPTY_MEMBER resource_ptr _resource;
+    arena<MemoryResource>          _strings;
+    slot*                          _slots;
+    std::size_t                    _capacity;
+    std::size_t                    _size;
+};
+} // namespace lexy
+
+namespace lexy
+{
+struct _intern_table_state
+{
+    template <typename State>
+    constexpr State& operator()(State& state) const
+    {
+        return state;
+    }
+};
+
+template <typename Table, typename TableFn>
+struct _as_interned
+{
+    TableFn _table;
+
+    using return_type = typename Table::handle;
+    using _char_type  = typename Table::char_type;
+
+    template <typename State>
+    struct _with_state
+    {
+        State&         _state;
+        const TableFn& _table;
+
+        template <typename Reader>
+        constexpr return_type operator()(lexeme<Reader> lex) const
+        {
+            static_assert(std::is_convertible_v<typename lexeme<Reader>::iterator,
+                                                const _char_type*>,
+                          "lexeme must be a contiguous range of the table's character type");
+
+            Table& table = _detail::invoke(_table, _state);
+            return table.intern(lex.data(), lex.size());
+        }
+    };
+
+    template <typename State>
+    constexpr auto operator[](State& state) const
+    {
+        return _with_state<State>{state, _table};
+    }
+
+    template <typename Fn>
+    constexpr auto table(Fn fn) const
+    {
+        return _as_interned<Table, Fn>{fn};
+    }
+};
+
+/// A callback that interns a lexeme in the `Table` of the parse state and returns its handle.
+/// By default, the parse state is the table; use `.table()` to obtain it from the parse state.
+template <typename Table>
+constexpr auto as_interned = _as_interned<Table, _intern_table_state>{};
+} // namespace lexy
+
+#endif // LEXY_CALLBACK_INTERN_HPP_INCLUDED
@@ -0,0 +1,97 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_CALLBACK_LAZY_HPP_INCLUDED
+#define LEXY_CALLBACK_LAZY_HPP_INCLUDED
+
+#include <lexy/_detail/stateless_lambda.hpp>
+#include <lexy/callback/base.hpp>
+#include <lexy/callback/container.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+
+namespace lexy
+{
+/// A value of type `T` that is only created from a lexeme when it is requested.
+template <typename T, typename Reader>
+class lazy
+{
+public:
+    using value_type = T;
+    using lexeme     = lexy::lexeme<Reader>;
+
+    using callback_fn = T (*)(lexeme);
+
+    constexpr explicit lazy(lexeme lex, callback_fn fn) noexcept : _lexeme(lex), _fn(fn) {}
+
+    constexpr lexeme get_lexeme() const noexcept
+    {
+        return _lexeme;
+    }
+
+    /// Invokes the callback to create the value.
+    /// It is not cached, so every call creates a new value.
+    constexpr T get() const
+    {
+        return _fn(_lexeme);
+    }
+
+private:
+    lexeme      _lexeme;
+    callback_fn _fn;
+};
+
+template <typename T, typename Input>
+using lazy_for = lazy<T, lexy::input_reader<Input>>;
+
+template <typename Reader, typename Callback>
+struct _as_lazy
+{
+    using _value_type = typename Callback::return_type;
+    using return_type = lazy<_value_type, Reader>;
+
+    static constexpr _value_type _invoke(lexy::lexeme<Reader> lexeme)
+    {
+        return _detail::stateless_lambda<Callback>::get()(lexeme);
+    }
+
+    constexpr return_type operator()(lexy::lexeme<Reader> lexeme) const
+    {
+        return return_type(lexeme, &_invoke);
+    }
+};
+
+/// Creates a callback that only stores the lexeme and invokes `Callback` once requested.
+template <typename Input, typename Callback>
+constexpr auto as_lazy(Callback)
+{
+    static_assert(lexy::is_callback<Callback> && std::is_empty_v<Callback>,
+                  "lazy callback must be a stateless callback");
+    return _as_lazy<lexy::input_reader<Input>, Callback>{};
+}
+
+/// Creates the values of all lazy values in the range and returns them in a container.
+template <typename Container, typename Range>
+constexpr Container materialize(const Range& lazies)
+{
+    Container result;
+    if constexpr (_has_reserve<Container>)
+        result.reserve(lazies.size());
+
+    for (auto& lazy : lazies)
+        result.push_back(lazy.get());
+    return result;
+}
+/// Same as above, but only for the lazy values whose lexeme satisfies the predicate.
+template <typename Container, typename Range, typename Predicate>
+constexpr Container materialize(const Range& lazies, Predicate pred)
+{
+    Container result;
+    for (auto& lazy : lazies)
+        if (pred(lazy.get_lexeme()))
+            result.push_back(lazy.get());
+    return result;
+}
+} // namespace lexy
+
+#endif // LEXY_CALLBACK_LAZY_HPP_INCLUDED
@@ -204,6 +204,223 @@ struct _as_string
 /// or `.append()` for lexemes or other strings.
 template <typename String, typename Encoding = deduce_encoding<_string_char_type<String>>>
 constexpr auto as_string = _as_string<String, Encoding>{};
+
+/// Either a view into the input or an owned `String`.
+template <typename String>
+class string_view_or_owned
+{
+public:
+    using string_type = String;
+    using char_type   = _string_char_type<String>;
+
+    constexpr string_view_or_owned() noexcept : _data(nullptr), _size(0), _is_owned(false) {}
+    constexpr explicit string_view_or_owned(const char_type* data, std::size_t size) noexcept
+    : _data(data), _size(size), _is_owned(false)
+    {}
+    constexpr explicit string_view_or_owned(String&& str)
+    : _owned(LEXY_MOV(str)), _data(nullptr), _size(0), _is_owned(true)
+    {}
+
+    /// Whether or not the string had to be allocated.
+    constexpr bool is_owned() const noexcept
+    {
+        return _is_owned;
+    }
+
+    constexpr const char_type* data() const noexcept
+    {
+        return _is_owned ? _owned.data() : _data;
+    }
+    constexpr std::size_t size() const noexcept
+    {
+        return _is_owned ? std::size_t(_owned.size()) : _size;
+    }
+    constexpr bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    /// Returns a view (e.g. `std::string_view`) of the string.
+    /// If it is owned, the view is only valid as long as this object.
+    template <typename View>
+    constexpr auto view() const noexcept -> decltype(View(data(), size()))
+    {
+        return View(data(), size());
+    }
+
+    /// Returns the owned string, copying the viewed characters if necessary.
+    constexpr String to_string() const&
+    {
+        return _is_owned ? _owned : String(_data, _size);
+    }
+    constexpr String to_string() &&
+    {
+        return _is_owned ? LEXY_MOV(_owned) : String(_data, _size);
+    }
+
+private:
+    // The owned string is always constructed, but doesn't allocate when it's empty.
+    String           _owned;
+    const char_type* _data;
+    std::size_t      _size;
+    bool             _is_owned;
+};
+
+template <typename String, typename Encoding>
+struct _as_string_view_or_owned
+{
+    using return_type = string_view_or_owned<String>;
+    using _char_type  = _string_char_type<String>;
+    static_assert(lexy::_detail::is_compatible_char_type<Encoding, _char_type>,
+                  "invalid character type/encoding combination");
+
+    template <typename Iterator>
+    static constexpr bool _is_pointer = std::is_convertible_v<Iterator, const _char_type*>;
+
+    constexpr return_type operator()(nullopt&&) const
+    {
+        return return_type();
+    }
+    constexpr return_type operator()(String&& str) const
+    {
+        return return_type(LEXY_MOV(str));
+    }
+
+    template <typename Iterator>
+    constexpr auto operator()(Iterator begin, Iterator end) const
+        -> decltype(String(begin, end), return_type())
+    {
+        if constexpr (_is_pointer<Iterator>)
+            return return_type(begin, std::size_t(end - begin));
+        else
+            return return_type(String(begin, end));
+    }
+
+    template <typename Reader>
+    constexpr return_type operator()(lexeme<Reader> lex) const
+    {
+        static_assert(lexy::char_type_compatible_with_reader<Reader, _char_type>,
+                      "cannot convert lexeme to this string type");
+
+        if constexpr (_is_pointer<typename lexeme<Reader>::iterator>)
+            return return_type(lex.data(), lex.size());
+        else
+            return return_type(String(lex.begin(), lex.end()));
+    }
+
+    constexpr return_type operator()(code_point cp) const
+    {
+        return return_type(_as_string<String, Encoding>{}(cp));
+    }
+
+    struct _sink
+    {
+        // Until something is pushed that isn't in the input, we only extend the view.
+        const _char_type* _data     = nullptr;
+        std::size_t       _size     = 0;
+        bool              _is_owned = false;
+        String            _result;
+
+        using return_type = string_view_or_owned<String>;
+
+        constexpr void _make_owned()
+        {
+            if (_is_owned)
+                return;
+
+            _result.append(_data, _data + _size);
+            _is_owned = true;
+        }
+
+        constexpr bool _extend_view(const _char_type* begin, const _char_type* end)
+        {
+            if (_is_owned)
+                return false;
+
+            if (_size == 0)
+            {
+                _data = begin;
+                _size = std::size_t(end - begin);
+                return true;
+            }
+            else if (_data + _size == begin)
+            {
+                _size += std::size_t(end - begin);
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template <typename CharT, typename = decltype(LEXY_DECLVAL(String).push_back(CharT()))>
+        constexpr void operator()(CharT c)
+        {
+            _make_owned();
+            _result.push_back(c);
+        }
+
+        constexpr void operator()(String&& str)
+        {
+            _make_owned();
+            _result.append(LEXY_MOV(str));
+        }
+
+        template <typename Str = String, typename Iterator>
+        constexpr auto operator()(Iterator begin, Iterator end)
+            -> decltype(void(LEXY_DECLVAL(Str).append(begin, end)))
+        {
+            if constexpr (_is_pointer<Iterator>)
+                if (_extend_view(begin, end))
+                    return;
+
+            _make_owned();
+            _result.append(begin, end);
+        }
+
+        template <typename Reader>
+        constexpr void operator()(lexeme<Reader> lex)
+        {
+            static_assert(lexy::char_type_compatible_with_reader<Reader, _char_type>,
+                          "cannot convert lexeme to this string type");
+            if constexpr (_is_pointer<typename lexeme<Reader>::iterator>)
+                if (_extend_view(lex.data(), lex.data() + lex.size()))
+                    return;
+
+            _make_owned();
+            _result.append(lex.begin(), lex.end());
+        }
+
+        constexpr void operator()(code_point cp)
+        {
+            typename Encoding::char_type buffer[4] = {};
+            auto size = _detail::encode_code_point<Encoding>(cp.value(), buffer, 4);
+
+            _make_owned();
+            _result.append(buffer, buffer + size);
+        }
+
+        constexpr return_type finish() &&
+        {
+            if (_is_owned)
+                return return_type(LEXY_MOV(_result));
+            else
+                return return_type(_data, _size);
+        }
+    };
+
+    constexpr auto sink() const
+    {
+        return _sink{};
+    }
+};
+
+/// A callback with sink that creates a string that is either a view into the input or owned.
+/// As a sink, it only allocates if it receives something other than adjacent lexemes,
+/// e.g. an escape sequence or a code point.
+template <typename String, typename Encoding = deduce_encoding<_string_char_type<String>>>
+constexpr auto as_string_view_or_owned = _as_string_view_or_owned<String, Encoding>{};
 } // namespace lexy
 
 #endif // LEXY_CALLBACK_STRING_HPP_INCLUDED
@@ -287,6 +287,43 @@ LEXY_FORCE_INLINE constexpr bool code_point_has_properties(char32_t cp)
     auto props = _unicode_db::binary_properties[idx];
     return (props & mask) != 0;
 }
+
+// Matches a UTF-8 encoded code point that has the property directly on the code units.
+// The reader must be at a lead byte of a multi-byte sequence, i.e. in the range 0xC2-0xF4.
+// If it returns true, the reader has consumed the entire sequence.
+template <lexy::_unicode_db::binary_properties_t Prop, typename Reader>
+LEXY_FORCE_INLINE constexpr bool utf8_dfa_match(Reader& reader)
+{
+    constexpr auto dfa = _unicode_db::utf8_dfa<Prop>;
+    static_assert(dfa != nullptr, "no UTF-8 automaton generated for that property");
+
+    auto is_continuation = [](auto c) { return (static_cast<unsigned char>(c) & 0xC0) == 0x80; };
+    auto lower_bits      = [](auto c) { return static_cast<unsigned char>(c) & 0x3Fu; };
+
+    // The start state is indexed by the lead byte.
+    auto state = dfa[lower_bits(reader.peek())];
+    reader.bump();
+
+    // Follow the transitions until there is only one continuation byte left.
+    while (state < _unicode_db::utf8_dfa_final)
+    {
+        auto c = reader.peek();
+        if (!is_continuation(c))
+            return false;
+
+        state = dfa[state * 64u + lower_bits(c)];
+        reader.bump();
+    }
+
+    // The last continuation byte is looked up in the mask of the final state.
+    auto c = reader.peek();
+    if (!is_continuation(c))
+        return false;
+
+    auto mask = _unicode_db::utf8_dfa_masks[state - _unicode_db::utf8_dfa_final];
+    reader.bump();
+    return ((mask >> lower_bits(c)) & 1) != 0;
+}
 } // namespace lexy::_detail
 
 #    define LEXY_UNICODE_PROPERTY(Name) ::lexy::_unicode_db::Name
@@ -296,6 +333,9 @@ namespace lexy::_detail
 {
 template <int... Props>
 bool code_point_has_properties(char32_t cp); // not implemented
+
+template <int Prop, typename Reader>
+bool utf8_dfa_match(Reader& reader); // not implemented
 } // namespace lexy::_detail
 
 #    define LEXY_UNICODE_PROPERTY(Name) 0
@@ -44,6 +44,7 @@
 #include <lexy/dsl/position.hpp>
 #include <lexy/dsl/production.hpp>
 #include <lexy/dsl/punctuator.hpp>
+#include <lexy/dsl/real.hpp>
 #include <lexy/dsl/recover.hpp>
 #include <lexy/dsl/repeat.hpp>
 #include <lexy/dsl/return.hpp>
@@ -56,6 +57,7 @@
 #include <lexy/dsl/terminator.hpp>
 #include <lexy/dsl/times.hpp>
 #include <lexy/dsl/token.hpp>
+#include <lexy/dsl/token_dfa.hpp>
 #include <lexy/dsl/unicode.hpp>
 #include <lexy/dsl/until.hpp>
 #include <lexy/dsl/whitespace.hpp>
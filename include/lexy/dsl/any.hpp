@@ -10,6 +10,17 @@
 
 namespace lexyd
 {
+// Whether we can skip to the end in constant time.
+// This requires that no char can be mistaken for EOF.
+template <typename Reader>
+constexpr bool _any_can_skip = [] {
+    if constexpr (lexy::_detail::is_bulk_reader<Reader>)
+        return !std::is_same_v<typename Reader::encoding::int_type,
+                               typename Reader::encoding::char_type>;
+    else
+        return false;
+}();
+
 struct _any : token_base<_any, unconditional_branch_base>
 {
     template <typename Reader>
@@ -22,11 +33,17 @@ struct _any : token_base<_any, unconditional_branch_base>
         constexpr std::true_type try_parse(Reader reader)
         {
             using encoding = typename Reader::encoding;
-            if constexpr (lexy::_detail::is_swar_reader<Reader>)
+            if constexpr (_any_can_skip<Reader>)
+            {
+                reader.advance(reader.remaining());
+            }
+            else if constexpr (lexy::_detail::has_swar<Reader>)
             {
-                while (!lexy::_detail::swar_has_char<typename encoding::char_type, encoding::eof()>(
-                    reader.peek_swar()))
-                    reader.bump_swar();
+                while (lexy::_detail::swar_available(reader)
+                       && !lexy::_detail::swar_has_char<typename encoding::char_type,
+                                                        encoding::eof()>(
+                           lexy::_detail::peek_swar(reader)))
+                    lexy::_detail::bump_swar(reader);
             }
 
             while (reader.peek() != encoding::eof())
@@ -5,10 +5,15 @@
 #define LEXY_DSL_BYTE_HPP_INCLUDED
 
 #include <cstdint>
+#include <cstring>
 #include <lexy/_detail/integer_sequence.hpp>
 #include <lexy/dsl/base.hpp>
 #include <lexy/dsl/char_class.hpp>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/repeat.hpp>
 #include <lexy/dsl/token.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
 
 //=== byte ===//
 namespace lexyd
@@ -135,6 +140,19 @@ constexpr auto byte = _b<1, void>{};
 /// Matches N arbitrary bytes.
 template <std::size_t N>
 constexpr auto bytes = _b<N, void>{};
+
+// Reports that the input ended at `end` before all bytes starting at `begin` have been matched.
+// Same as a failed token_parse() of the corresponding `dsl::bytes`.
+template <typename Context, typename Reader>
+constexpr bool _bytes_fail(Context& context, Reader& reader, typename Reader::iterator begin,
+                           typename Reader::marker end)
+{
+    context.on(_ev::token{}, lexy::error_token_kind, begin, end.position());
+    auto err = lexy::error<Reader, lexy::expected_char_class>(end.position(), "byte");
+    context.on(_ev::error{}, err);
+    reader.reset(end);
+    return false;
+}
 } // namespace lexyd
 
 namespace lexy
@@ -254,6 +272,56 @@ auto _bint()
 
 template <std::size_t N>
 using bint = decltype(_bint<N>());
+
+template <typename T>
+constexpr T bint_byte_swap(T value)
+{
+#if defined(__GNUC__)
+    if constexpr (sizeof(T) == 2)
+        return __builtin_bswap16(value);
+    else if constexpr (sizeof(T) == 4)
+        return __builtin_bswap32(value);
+    else
+        return __builtin_bswap64(value);
+#else
+    T result = 0;
+    for (auto i = 0u; i != sizeof(T); ++i)
+    {
+        result = static_cast<T>((result << 8) | (value & 0xFF));
+        value  = static_cast<T>(value >> 8);
+    }
+    return result;
+#endif
+}
+
+// Converts the N bytes starting at begin into an integer.
+// Unlike _bint::_pc, the caller has to ensure that there are enough bytes.
+template <std::size_t N, int Endianness, typename Iterator>
+constexpr bint<N> bint_load(Iterator begin)
+{
+    if constexpr (std::is_pointer_v<Iterator>)
+    {
+        if (!LEXY_IS_CONSTANT_EVALUATED())
+        {
+            bint<N> result = 0;
+            std::memcpy(&result, begin, N);
+            if constexpr (N > 1 && Endianness != bint_native)
+                result = bint_byte_swap(result);
+            return result;
+        }
+    }
+
+    bint<N> result = 0;
+    for (auto i = 0u; i != N; ++i)
+    {
+        auto byte = static_cast<bint<N>>(static_cast<unsigned char>(*begin++));
+        if constexpr (Endianness == bint_big)
+            result = static_cast<bint<N>>((result << 8) | byte);
+        else
+            result = static_cast<bint<N>>(result | (byte << (8 * i)));
+    }
+    return result;
+}
 } // namespace lexy::_detail
 
 namespace lexy
@@ -269,6 +337,63 @@ struct mismatched_byte_count
 
 namespace lexyd
 {
+template <std::size_t N, int Endianness>
+struct _binta : rule_base
+{
+    template <typename NextParser>
+    struct p
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_PARSER_FUNC static bool parse(Context& context, Reader& reader, std::size_t count,
+                                           Args&&... args)
+        {
+            static_assert(lexy::is_byte_encoding<typename Reader::encoding>);
+
+            auto sink  = context.value_callback().sink();
+            auto begin = reader.position();
+            if constexpr (lexy::_detail::is_bulk_reader<Reader>)
+            {
+                // We check that there are enough bytes once, then convert them without EOF checks.
+                if (reader.remaining() / N < count)
+                {
+                    auto end = reader;
+                    end.advance(reader.remaining());
+                    return _bytes_fail(context, reader, begin, end.current());
+                }
+
+                // The count comes from the input, so we can only reserve it once we know that the
+                // input actually contains that many integers.
+                if constexpr (lexy::_has_reserve<decltype(sink)>)
+                    sink.reserve(count);
+
+                for (auto i = std::size_t(0); i != count; ++i)
+                {
+                    sink(lexy::_detail::bint_load<N, Endianness>(reader.position()));
+                    reader.advance(N);
+                }
+            }
+            else
+            {
+                for (auto i = std::size_t(0); i != count; ++i)
+                {
+                    lexy::token_parser_for<_b<N, void>, Reader> parser(reader);
+                    if (!parser.try_parse(reader))
+                        return _bytes_fail(context, reader, begin, parser.end);
+
+                    sink(lexy::_detail::bint_load<N, Endianness>(reader.position()));
+                    reader.reset(parser.end);
+                }
+            }
+
+            if (count > 0)
+                context.on(_ev::token{}, lexy::any_token_kind, begin, reader.position());
+
+            return lexy::whitespace_parser<Context, lexy::sink_finish_parser<NextParser>>::
+                parse(context, reader, sink, LEXY_FWD(args)...);
+        }
+    };
+};
+
 template <std::size_t N, int Endianness, typename Rule = void>
 struct _bint : branch_base
 {
@@ -375,6 +500,14 @@ struct _bint : branch_base
         static_assert(std::is_void_v<Rule>);
         return _bint<N, Endianness, Token>{};
     }
+
+    /// Matches `n` integers, where `n` is the value produced by `Count`.
+    template <typename Count>
+    constexpr auto array(Count) const
+    {
+        static_assert(std::is_void_v<Rule>);
+        return _rep<Count, _binta<N, Endianness>>{};
+    }
 };
 
 /// Matches one byte and converts it into an 8-bit integer.
@@ -396,4 +529,123 @@ inline constexpr auto little_bint64 = _bint<8, lexy::_detail::bint_little>{};
 inline constexpr auto big_bint64    = _bint<8, lexy::_detail::bint_big>{};
 } // namespace lexyd
 
+//=== blob ===//
+namespace lexyd
+{
+template <typename Rule>
+struct _blob : rule_base
+{
+    // Called after Rule has parsed the content, which ends at the end of the blob.
+    template <typename NextParser>
+    struct _cont
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_PARSER_FUNC static bool parse(Context& context, Reader& content, Reader& reader,
+                                           Args&&... args)
+        {
+            if (content.peek() != Reader::encoding::eof())
+            {
+                // Report that we've failed, but recover by skipping the remaining content.
+                auto err = lexy::error<Reader, lexy::expected_eof>(content.position());
+                context.on(_ev::error{}, err);
+
+                auto begin = content.position();
+                while (content.peek() != Reader::encoding::eof())
+                    content.bump();
+                context.on(_ev::token{}, lexy::error_token_kind, begin, content.position());
+            }
+
+            reader.reset(content.current());
+            return lexy::whitespace_parser<Context, NextParser>::parse(context, reader,
+                                                                       LEXY_FWD(args)...);
+        }
+    };
+
+    template <typename NextParser>
+    struct p
+    {
+        template <typename Context, typename Reader, typename... Args>
+        LEXY_PARSER_FUNC static bool parse(Context& context, Reader& reader, std::size_t count,
+                                           Args&&... args)
+        {
+            static_assert(lexy::is_byte_encoding<typename Reader::encoding>);
+
+            auto begin = reader.position();
+            if constexpr (lexy::_detail::is_bulk_reader<Reader>)
+            {
+                // We don't need to look at the bytes, just check that there are enough of them.
+                if (reader.remaining() < count)
+                {
+                    auto end = reader;
+                    end.advance(reader.remaining());
+                    return _bytes_fail(context, reader, begin, end.current());
+                }
+
+                reader.advance(count);
+            }
+            else
+            {
+                for (auto i = std::size_t(0); i != count; ++i)
+                {
+                    if (reader.peek() == Reader::encoding::eof())
+                        return _bytes_fail(context, reader, begin, reader.current());
+                    reader.bump();
+                }
+            }
+            auto end = reader.position();
+
+            if constexpr (std::is_void_v<Rule>)
+            {
+                if (count > 0)
+                    context.on(_ev::token{}, lexy::any_token_kind, begin, end);
+
+                return lexy::whitespace_parser<Context, NextParser>::parse(context, reader,
+                                                                           LEXY_FWD(args)...,
+                                                                           lexy::lexeme(reader,
+                                                                                        begin));
+            }
+            else
+            {
+                // We parse the content on a reader that ends with the blob, so Rule can't
+                // consume more than that.
+                auto content = lexy::partial_input(reader, begin, end).reader();
+                static_assert(std::is_same_v<decltype(content), Reader>,
+                              "blob content can only be parsed on inputs with a range reader");
+                reader.reset(content.current());
+
+                using parser = lexy::parser_for<Rule, _cont<NextParser>>;
+                if (!parser::parse(context, content, reader, LEXY_FWD(args)...))
+                {
+                    // If Rule failed, _cont wasn't called and reader is still at the beginning.
+                    // We continue where Rule stopped instead.
+                    if (reader.position() == begin)
+                        reader.reset(content.current());
+                    return false;
+                }
+
+                return true;
+            }
+        }
+    };
+};
+
+template <typename Count>
+struct _blob_dsl : _rep<Count, _blob<void>>
+{
+    /// Parses the bytes using `Rule` instead of producing a lexeme.
+    template <typename Rule>
+    constexpr auto operator()(Rule) const
+    {
+        return _rep<Count, _blob<Rule>>{};
+    }
+};
+
+/// Matches `n` bytes, where `n` is the value produced by `Count`.
+template <typename Count>
+constexpr auto blob(Count)
+{
+    return _blob_dsl<Count>{};
+}
+} // namespace lexyd
+
 #endif // LEXY_DSL_BYTE_HPP_INCLUDED
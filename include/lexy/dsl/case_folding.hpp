@@ -116,6 +116,12 @@ struct _acfr // ascii case folding reader
 };
 } // namespace lexy
 
+namespace lexy::_detail
+{
+template <typename Reader>
+constexpr auto is_swar_ascii_case_folding_reader<lexy::_acfr<Reader>> = is_swar_reader<Reader>;
+} // namespace lexy::_detail
+
 namespace lexyd::ascii
 {
 struct _cf_dsl
@@ -158,6 +158,18 @@ struct ascii_set_matcher<CompressedAsciiSet, index_sequence<RangeIdx...>,
             // or one of the single characters.
             || ((cur == to_int_type<Encoding>(CompressedAsciiSet.singles[SingleIdx])) || ...);
     }
+
+    // Returns a swar_int where the most significant bit of each char in the set is set.
+    template <typename Encoding>
+    static constexpr swar_int match_swar([[maybe_unused]] swar_int cur)
+    {
+        using char_type = typename Encoding::char_type;
+        return (swar_range_mask<char_type, CompressedAsciiSet.range_lower[RangeIdx],
+                                CompressedAsciiSet.range_upper[RangeIdx]>(cur)
+                | ... | 0)
+               | (swar_char_mask<char_type, char_type(CompressedAsciiSet.singles[SingleIdx])>(cur)
+                  | ... | 0);
+    }
 };
 } // namespace lexy::_detail
 
@@ -183,6 +195,15 @@ struct char_class_base : token_base<Derived>, _char_class_base
         return {};
     }
 
+    /// Matches a non-ASCII code point directly on UTF-8 code units, if possible.
+    /// The reader is at a lead byte of a multi-byte sequence; it must behave like
+    /// `char_class_match_cp()`.
+    template <typename Reader>
+    static constexpr std::false_type char_class_match_utf8(Reader&)
+    {
+        return {};
+    }
+
     template <typename Reader, typename Context>
     static constexpr void char_class_report_error(Context&                  context,
                                                   typename Reader::iterator position)
@@ -230,16 +251,36 @@ struct char_class_base : token_base<Derived>, _char_class_base
                 static_assert(Derived::char_class_unicode(),
                               "cannot use this character class with Unicode encoding");
 
-                // Parse one code point.
-                auto result = lexy::_detail::parse_code_point(reader);
-                if (result.error != lexy::_detail::cp_error::success)
-                    return false;
-
-                if (!Derived::char_class_match_cp(result.cp))
-                    return false;
-
-                end = result.end;
-                return true;
+                if constexpr ((std::is_same_v<typename Reader::encoding, lexy::utf8_encoding>
+                               || std::is_same_v<typename Reader::encoding,
+                                                 lexy::utf8_char_encoding>)
+                              && !std::is_same_v<decltype(Derived::char_class_match_utf8(reader)),
+                                                 std::false_type>)
+                {
+                    // Match the code units without decoding the code point.
+                    auto lead = static_cast<unsigned char>(reader.peek());
+                    if (lead < 0xC2 || lead > 0xF4)
+                        return false;
+
+                    if (!Derived::char_class_match_utf8(reader))
+                        return false;
+
+                    end = reader.current();
+                    return true;
+                }
+                else
+                {
+                    // Parse one code point.
+                    auto result = lexy::_detail::parse_code_point(reader);
+                    if (result.error != lexy::_detail::cp_error::success)
+                        return false;
+
+                    if (!Derived::char_class_match_cp(result.cp))
+                        return false;
+
+                    end = result.end;
+                    return true;
+                }
             }
             else
             {
@@ -47,6 +47,46 @@ struct _cp : char_class_base<_cp<Predicate>>
             return Predicate{}(lexy::code_point(cp));
     }
 
+    template <typename Encoding>
+    static constexpr auto char_class_match_swar([[maybe_unused]] lexy::_detail::swar_int c)
+    {
+        using char_type = typename Encoding::char_type;
+        if constexpr (!std::is_void_v<Predicate>)
+        {
+            return std::false_type{};
+        }
+        else if constexpr (std::is_same_v<Encoding, lexy::utf16_encoding>)
+        {
+            // Every code unit that isn't a surrogate is a code point on its own.
+            // Otherwise, every high surrogate must be followed by a low surrogate in the same
+            // block, and every low surrogate must be preceded by a high surrogate.
+            constexpr auto mask      = lexy::_detail::swar_fill(char_type(0xFC00));
+            constexpr auto high      = lexy::_detail::swar_fill(char_type(0xD800));
+            constexpr auto low       = lexy::_detail::swar_fill(char_type(0xDC00));
+            constexpr auto last_char = lexy::_detail::swar_int(1)
+                                       << (lexy::_detail::char_bit_size<lexy::_detail::swar_int>
+                                           - 1);
+
+            auto is_high = lexy::_detail::swar_zero_mask<char_type>((c & mask) ^ high);
+            auto is_low  = lexy::_detail::swar_zero_mask<char_type>((c & mask) ^ low);
+            // The high surrogate of the last char is shifted out, so we need to check it as well.
+            return (is_high << lexy::_detail::char_bit_size<char_type>) == is_low
+                   && (is_high & last_char) == 0;
+        }
+        else if constexpr (std::is_same_v<Encoding, lexy::ascii_encoding>
+                           || std::is_same_v<Encoding, lexy::utf8_encoding>
+                           || std::is_same_v<Encoding, lexy::utf8_char_encoding>)
+        {
+            // Every ASCII character is a code point on its own.
+            constexpr auto mask = lexy::_detail::swar_fill_compl(char_type(0x7F));
+            return (c & mask) == 0;
+        }
+        else
+        {
+            return std::false_type{};
+        }
+    }
+
     //=== dsl ===//
     template <typename P>
     constexpr auto if_() const
@@ -49,19 +49,73 @@ struct _del_chars
         begin = recover_end;
     }
 
-    template <typename Close, typename... Escs>
-    constexpr void parse_swar(Reader& reader, Close, Escs...)
+    // Whether the content contains every printable ASCII character and the limit doesn't.
+    // Then, only the closing delimiter and escape sequences can end a run of printable ASCII.
+    template <typename Limit>
+    static constexpr bool _skip_printable = [] {
+        constexpr auto content = CharClass::char_class_ascii();
+        for (auto c = 0x20; c <= 0x7E; ++c)
+            if (!content.contains[c])
+                return false;
+        return Limit::is_nonprintable;
+    }();
+
+    template <typename Limit, typename Close, typename... Escs>
+    constexpr void parse_swar(Reader& reader, Limit, Close, Escs...)
     {
         using encoding = typename Reader::encoding;
 
         // If we have a SWAR reader and the Close and Escape chars are literal rules,
         // we can munch as much content as possible in a fast loop.
-        // We also need to efficiently check for the CharClass for it to make sense.
         if constexpr (lexy::_detail::is_swar_reader<Reader> //
                       && (lexy::is_literal_rule<Close> && ... && Escs::esc_is_literal)
-                      && !std::is_same_v<
-                          decltype(CharClass::template char_class_match_swar<encoding>({})),
-                          std::false_type>)
+                      && _skip_printable<Limit>)
+        {
+            using char_type = typename encoding::char_type;
+            using lexy::_detail::swar_char_mask;
+            using lexy::_detail::swar_fill_compl;
+            using lexy::_detail::swar_zero_mask;
+
+            constexpr auto close_char = Close::template lit_first_char<encoding>();
+            constexpr auto eof_char   = char_type(encoding::eof());
+            // The bits that are zero for 0x00-0x1F and for ASCII, respectively.
+            constexpr auto control_bits = swar_fill_compl(char_type(0x1F));
+            constexpr auto ascii_bits   = swar_fill_compl(char_type(0x7F));
+            constexpr auto msb_mask     = lexy::_detail::swar_msb_mask<char_type>;
+
+            while (true)
+            {
+                auto cur = reader.peek_swar();
+
+                // We need to stop at every char that isn't printable ASCII (this includes EOF),
+                // and at the initial character of the closing delimiter and escape sequences.
+                auto stop = swar_zero_mask<char_type>(cur & control_bits)
+                            | swar_char_mask<char_type, 0x7F>(cur)
+                            | (msb_mask ^ swar_zero_mask<char_type>(cur & ascii_bits))
+                            | swar_char_mask<char_type, close_char>(cur);
+                if constexpr (sizeof...(Escs) > 0)
+                    stop |= (swar_char_mask<char_type, Escs::template esc_first_char<encoding>()>(
+                                 cur)
+                             | ...);
+                if constexpr (lexy::_detail::make_uchar(eof_char) < 0x80)
+                    stop |= swar_char_mask<char_type, eof_char>(cur);
+
+                if (stop != 0)
+                {
+                    // Skip everything before the first char we need to look at.
+                    reader.bump_swar(lexy::_detail::swar_find_first<char_type>(stop));
+                    break;
+                }
+
+                reader.bump_swar();
+            }
+        }
+        // Otherwise, we need to efficiently check for the CharClass for it to make sense.
+        else if constexpr (lexy::_detail::is_swar_reader<Reader> //
+                           && (lexy::is_literal_rule<Close> && ... && Escs::esc_is_literal)
+                           && !std::is_same_v<
+                               decltype(CharClass::template char_class_match_swar<encoding>({})),
+                               std::false_type>)
         {
             using char_type = typename encoding::char_type;
             using lexy::_detail::swar_has_char;
@@ -182,6 +236,22 @@ struct _del_limit
 {
     using error = Error;
 
+    // Whether the limit never starts with a printable ASCII character.
+    static constexpr bool is_nonprintable = [] {
+        if constexpr (lexy::is_char_class_rule<Token>)
+        {
+            constexpr auto limit = Token::char_class_ascii();
+            for (auto c = 0x20; c <= 0x7E; ++c)
+                if (limit.contains[c])
+                    return false;
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+
     template <typename Reader>
     static constexpr bool peek(Reader reader)
     {
@@ -193,6 +263,8 @@ struct _del_limit<void, Error>
 {
     using error = Error;
 
+    static constexpr bool is_nonprintable = true;
+
     template <typename Reader>
     static constexpr bool peek(Reader reader)
     {
@@ -216,7 +288,7 @@ struct _del : rule_base
         {
             // Parse as many content chars as possible.
             // If it returns, we need to look closer at the next char.
-            cur_chars.parse_swar(reader, Close{}, Escapes{}...);
+            cur_chars.parse_swar(reader, _limit{}, Close{}, Escapes{}...);
 
             // Check for closing delimiter.
             if (close.try_parse(context.control_block, reader))
@@ -301,11 +301,12 @@ constexpr bool _match_digits(Reader& reader)
 
     // Now we consume as many digits as possible.
     // First using SWAR...
-    if constexpr (lexy::_detail::is_swar_reader<Reader>)
+    if constexpr (lexy::_detail::has_swar<Reader>)
     {
         using char_type = typename Reader::encoding::char_type;
-        while (Base::template swar_matches<char_type>(reader.peek_swar()))
-            reader.bump_swar();
+        while (lexy::_detail::swar_available(reader)
+               && Base::template swar_matches<char_type>(lexy::_detail::peek_swar(reader)))
+            lexy::_detail::bump_swar(reader);
     }
 
     // ... then manually to get any trailing digits.
@@ -334,11 +335,13 @@ constexpr bool _match_digits_sep(Reader& reader)
         else
         {
             // Attempt to consume as many digits as possible.
-            if constexpr (lexy::_detail::is_swar_reader<Reader>)
+            if constexpr (lexy::_detail::has_swar<Reader>)
             {
                 using char_type = typename Reader::encoding::char_type;
-                while (Base::template swar_matches<char_type>(reader.peek_swar()))
-                    reader.bump_swar();
+                while (lexy::_detail::swar_available(reader)
+                       && Base::template swar_matches<char_type>(
+                           lexy::_detail::peek_swar(reader)))
+                    lexy::_detail::bump_swar(reader);
             }
 
             if (!lexy::try_match_token(digit<Base>, reader))
@@ -168,6 +168,12 @@ namespace lexy::_detail
 template <typename Operation>
 using op_of = LEXY_DECAY_DECLTYPE(Operation::op);
 
+template <std::size_t N>
+struct operator_index_map
+{
+    std::size_t value[N == 0 ? 1 : N];
+};
+
 template <typename... Operations>
 struct operation_list
 {
@@ -186,6 +192,44 @@ struct operation_list
 
     using ops = decltype((typename op_of<Operations>::op_literals{} + ... + op_lit_list{}));
 
+    template <typename Operation>
+    static constexpr bool contains()
+    {
+        return (std::is_same_v<Operation, Operations> || ...);
+    }
+
+    // The index of the first operator of Operation in ops.
+    template <typename Operation>
+    static constexpr std::size_t offset_of()
+    {
+        auto result = std::size_t(0);
+        (void)((std::is_same_v<Operation, Operations>
+                || (result += op_of<Operations>::op_literals::size, false))
+               || ...);
+        return result;
+    }
+
+    // Maps the index of each operator in ops to its index in Subset::ops, or Subset::ops::size.
+    template <typename Subset>
+    static LEXY_CONSTEVAL auto _index_map()
+    {
+        operator_index_map<ops::size> result{};
+
+        auto idx = std::size_t(0);
+        (void)(([&] {
+                    constexpr auto in_subset = Subset::template contains<Operations>();
+                    constexpr auto offset    = Subset::template offset_of<Operations>();
+                    for (auto i = 0u; i != op_of<Operations>::op_literals::size; ++i)
+                        result.value[idx++] = in_subset ? offset + i : Subset::ops::size;
+                }(),
+                true)
+               && ...);
+
+        return result;
+    }
+    template <typename Subset>
+    static constexpr operator_index_map<ops::size> index_map = _index_map<Subset>();
+
     template <template <typename> typename Continuation, typename Context, typename Reader,
               typename... Args>
     static constexpr bool apply(Context& context, Reader& reader, parsed_operator<Reader> op,
@@ -254,20 +298,55 @@ namespace lexyd
 template <typename RootOperation>
 struct _expr : rule_base
 {
+    template <typename Reader>
     struct _state
     {
         unsigned cur_group         = 0;
         unsigned cur_nesting_level = 0;
+
+        // An infix or postfix operator that was matched by an inner level, but binds at an outer
+        // level.
+        bool                                   has_op = false;
+        lexy::_detail::parsed_operator<Reader> op{};
+        typename Reader::marker                op_end{};
     };
 
+    // Matches an infix or postfix operator of any binding power.
+    template <typename Context, typename Reader>
+    static constexpr auto _parse_post_op(Reader& reader, _state<Reader>& state)
+    {
+        using all_ops = lexy::_detail::post_operation_list_of<typename Context::production, 0>;
+
+        if (state.has_op)
+        {
+            LEXY_PRECONDITION(state.op.cur.position() == reader.position());
+            state.has_op = false;
+            reader.reset(state.op_end);
+            return state.op;
+        }
+
+        return lexy::_detail::parse_operator<typename all_ops::ops>(reader);
+    }
+
+    // Un-does _parse_post_op(), but remembers the operator for the next call.
+    template <typename Reader>
+    static constexpr void _unparse_post_op(Reader& reader, _state<Reader>& state,
+                                           lexy::_detail::parsed_operator<Reader> op)
+    {
+        state.has_op = true;
+        state.op     = op;
+        state.op_end = reader.current();
+        reader.reset(op.cur);
+    }
+
     template <typename Operation>
     struct _continuation
     {
         struct _op_cont
         {
             template <typename Context, typename Reader, typename... Args>
-            LEXY_PARSER_FUNC static bool parse(Context& context, Reader& reader, _state& state,
-                                               Args&&... op_args)
+            LEXY_PARSER_FUNC static bool parse(Context& context, Reader& reader,
+                                               _state<Reader>& state, Args&&... op_args)
             {
                 using namespace lexy::_detail;
 
@@ -305,13 +384,17 @@ struct _expr : rule_base
                         context.value = {};
 
                         using op_rule = op_of<Operation>;
-                        auto op       = parse_operator<typename op_rule::op_literals>(reader);
-                        if (op.idx >= op_rule::op_literals::size)
+                        using all_ops = post_operation_list_of<typename Context::production, 0>;
+                        constexpr auto offset = all_ops::template offset_of<Operation>();
+
+                        auto op = _parse_post_op<Context>(reader, state);
+                        if (op.idx < offset || op.idx >= offset + op_rule::op_literals::size)
                         {
                             // The list ends at this point.
-                            reader.reset(op.cur);
+                            _unparse_post_op(reader, state, op);
                             break;
                         }
+                        op.idx -= offset;
 
                         // Need to finish the operator properly, by passing it to the sink.
                         if (!op_rule::template op_finish<lexy::sink_parser>(context, reader, op,
@@ -377,15 +460,18 @@ struct _expr : rule_base
                     if constexpr (std::is_base_of_v<infix_op_single, Operation>)
                     {
                         using op_rule = op_of<Operation>;
-                        auto op       = parse_operator<typename op_rule::op_literals>(reader);
-                        if (op.idx < op_rule::op_literals::size)
+                        using all_ops = post_operation_list_of<typename Context::production, 0>;
+                        constexpr auto offset = all_ops::template offset_of<Operation>();
+
+                        auto op = _parse_post_op<Context>(reader, state);
+                        if (offset <= op.idx && op.idx < offset + op_rule::op_literals::size)
                         {
                             using tag = typename Context::production::operator_chain_error;
                             auto err
                                 = lexy::error<Reader, tag>(op.cur.position(), reader.position());
                             context.on(_ev::error{}, err);
                         }
-                        reader.reset(op.cur);
+                        _unparse_post_op(reader, state, op);
                     }
                 }
                 else if constexpr (binding_power.is_postfix())
@@ -408,7 +494,8 @@ struct _expr : rule_base
 
         template <typename Context, typename Reader>
         static constexpr bool parse(Context& context, Reader& reader,
-                                    lexy::_detail::parsed_operator<Reader> op, _state& state)
+                                    lexy::_detail::parsed_operator<Reader> op,
+                                    _state<Reader>&                        state)
         {
             using namespace lexy::_detail;
             using production = typename Context::production;
@@ -451,15 +538,15 @@ struct _expr : rule_base
     };
 
     template <unsigned MinBindingPower, typename Context, typename Reader>
-    static constexpr bool _parse_lhs(Context& context, Reader& reader, _state& state)
+    static constexpr bool _parse_lhs(Context& context, Reader& reader, _state<Reader>& state)
     {
         using namespace lexy::_detail;
 
-        using op_list = pre_operation_list_of<typename Context::production, MinBindingPower>;
+        using production = typename Context::production;
         using atom_parser
-            = lexy::parser_for<LEXY_DECAY_DECLTYPE(Context::production::atom), final_parser>;
+            = lexy::parser_for<LEXY_DECAY_DECLTYPE(production::atom), final_parser>;
 
-        if constexpr (op_list::size == 0)
+        if constexpr (pre_operation_list_of<production, MinBindingPower>::size == 0)
         {
             // We don't have any prefix operators, so parse an atom directly.
             (void)state;
@@ -467,7 +554,14 @@ struct _expr : rule_base
         }
         else
         {
-            auto op = lexy::_detail::parse_operator<typename op_list::ops>(reader);
+            // We match all prefix operators at once and then check whether they bind at this level.
+            using all_ops = pre_operation_list_of<production, 0>;
+            using op_list = pre_operation_list_of<production, MinBindingPower>;
+            constexpr auto& index_map = all_ops::template index_map<op_list>;
+
+            auto op = lexy::_detail::parse_operator<typename all_ops::ops>(reader);
+            if (op.idx < all_ops::ops::size)
+                op.idx = index_map.value[op.idx];
             if (op.idx >= op_list::ops::size)
             {
                 // We don't have a prefix operator, so it must be an atom.
@@ -483,12 +577,12 @@ struct _expr : rule_base
     }
 
     template <unsigned MinBindingPower, typename Context, typename Reader>
-    static constexpr bool _parse(Context& context, Reader& reader, _state& state)
+    static constexpr bool _parse(Context& context, Reader& reader, _state<Reader>& state)
     {
         using namespace lexy::_detail;
-        using op_list = post_operation_list_of<typename Context::production, MinBindingPower>;
+        using production = typename Context::production;
 
-        if constexpr (op_list::size == 0)
+        if constexpr (post_operation_list_of<production, MinBindingPower>::size == 0)
         {
             // We don't have any post operators, so we only parse the left-hand-side.
             return _parse_lhs<MinBindingPower>(context, reader, state);
@@ -502,17 +596,26 @@ struct _expr : rule_base
                 return false;
             }
 
+            // We match all operators at once and then check whether they bind at this level.
+            // If not, the operator is handled by an outer level without matching it again.
+            using all_ops             = post_operation_list_of<production, 0>;
+            using op_list             = post_operation_list_of<production, MinBindingPower>;
+            constexpr auto& index_map = all_ops::template index_map<op_list>;
+
             auto result = true;
             while (true)
             {
-                auto op = parse_operator<typename op_list::ops>(reader);
-                if (op.idx >= op_list::ops::size)
+                auto op  = _parse_post_op<Context>(reader, state);
+                auto idx = op.idx < all_ops::ops::size ? index_map.value[op.idx]
+                                                       : op_list::ops::size;
+                if (idx >= op_list::ops::size)
                 {
-                    reader.reset(op.cur);
+                    _unparse_post_op(reader, state, op);
                     break;
                 }
 
-                result = op_list::template apply<_continuation>(context, reader, op, state);
+                result = op_list::template apply<_continuation>(context, reader, {op.cur, idx},
+                                                                state);
                 if (!result)
                     break;
             }
@@ -542,7 +645,7 @@ struct _expr : rule_base
             constexpr auto min_binding_power
                 = binding_power.is_prefix() ? binding_power.rhs : binding_power.lhs;
 
-            _state state;
+            _state<Reader> state;
             _parse<min_binding_power>(context, reader, state);
 
             // Regardless of parse errors, we can recover if we already had a value at some point.
@@ -4,6 +4,7 @@
 #ifndef LEXY_DSL_IDENTIFIER_HPP_INCLUDED
 #define LEXY_DSL_IDENTIFIER_HPP_INCLUDED
 
+#include <lexy/_detail/swar.hpp>
 #include <lexy/dsl/base.hpp>
 #include <lexy/dsl/char_class.hpp>
 #include <lexy/dsl/literal.hpp>
@@ -51,12 +52,13 @@ struct _idp : token_base<_idp<Leading, Trailing>>
             // Match zero or more trailing characters.
             while (true)
             {
-                if constexpr (lexy::_detail::is_swar_reader<Reader>)
+                if constexpr (lexy::_detail::has_swar<Reader>)
                 {
                     // If we have a swar reader, consume as much as possible at once.
-                    while (Trailing{}.template char_class_match_swar<typename Reader::encoding>(
-                        reader.peek_swar()))
-                        reader.bump_swar();
+                    while (lexy::_detail::swar_available(reader)
+                           && Trailing{}.template char_class_match_swar<typename Reader::encoding>(
+                               lexy::_detail::peek_swar(reader)))
+                        lexy::_detail::bump_swar(reader);
                 }
 
                 if (!lexy::try_match_token(Trailing{}, reader))
@@ -74,43 +76,312 @@ struct _idp : token_base<_idp<Leading, Trailing>>
         }
     };
 };
+} // namespace lexyd
+
+namespace lexy::_detail
+{
+// Loads Count chars starting at ptr, in the same order as swar_load().
+template <std::size_t Count, typename CharT>
+constexpr swar_int reserved_load(const CharT* ptr)
+{
+    static_assert(Count * sizeof(CharT) <= sizeof(swar_int));
+
+#if LEXY_IS_LITTLE_ENDIAN
+    if (!LEXY_IS_CONSTANT_EVALUATED())
+    {
+        using int_type = std::conditional_t<
+            Count * sizeof(CharT) == 1, std::uint_least8_t,
+            std::conditional_t<Count * sizeof(CharT) == 2, std::uint_least16_t,
+                               std::conditional_t<Count * sizeof(CharT) == 4, std::uint_least32_t,
+                                                  swar_int>>>;
+        static_assert(sizeof(int_type) == Count * sizeof(CharT));
+
+        int_type result = 0;
+        std::memcpy(&result, ptr, sizeof(int_type));
+        return result;
+    }
+#endif
+
+    auto result = swar_int(0);
+    for (auto i = 0u; i != Count; ++i)
+        result |= swar_int(make_uchar(ptr[i])) << (i * char_bit_size<CharT>);
+    return result;
+}
+
+// The first and last bytes of a string, loaded with two possibly overlapping loads.
+// Together with the length, they uniquely determine strings of up to 16 bytes.
+struct reserved_key
+{
+    swar_int head, tail;
+};
+
+template <typename CharT>
+constexpr reserved_key make_reserved_key(const CharT* str, std::size_t length)
+{
+    constexpr auto swar_size = sizeof(swar_int) / sizeof(CharT);
+    if (length >= swar_size)
+        return {swar_load(str), swar_load(str + length - swar_size)};
+
+    if constexpr (sizeof(CharT) <= 2)
+    {
+        constexpr auto half_size = swar_size / 2;
+        if (length >= half_size)
+            return {reserved_load<half_size>(str),
+                    reserved_load<half_size>(str + length - half_size)};
+    }
+    if constexpr (sizeof(CharT) == 1)
+    {
+        if (length >= 2)
+            return {reserved_load<2>(str), reserved_load<2>(str + length - 2)};
+    }
+
+    return {reserved_load<1>(str), 0};
+}
+
+constexpr std::uint_least64_t reserved_hash(reserved_key key)
+{
+    return (key.head * 0x9E37'79B9'7F4A'7C15 ^ key.tail) * 0xC2B2'AE3D'27D4'EB4F;
+}
+
+struct reserved_hash_layout
+{
+    std::size_t max_length;
+    std::size_t slot_count;
+    std::size_t pool_size;
+
+    // Each length has its own open addressing table with a load factor of at most 2/3.
+    static constexpr std::size_t bucket_size(std::size_t count)
+    {
+        if (count == 0)
+            return 0;
+
+        auto result = std::size_t(2);
+        while (2 * result < 3 * count)
+            result *= 2;
+        return result;
+    }
+};
+
+// Calls f(node, length) for every string in the trie.
+template <typename Trie, typename Fn>
+constexpr void visit_trie_strings(const Trie& trie, Fn f)
+{
+    std::size_t length[Trie::max_node_count] = {};
+    for (auto node = 1u; node != trie.node_count; ++node)
+    {
+        // The transition into a node has the index node - 1 and comes from a smaller node.
+        length[node] = length[trie.transition_from[node - 1]] + 1;
+        if (trie.node_value[node] != trie.node_no_match)
+            f(node, length[node]);
+    }
+}
+
+template <typename Trie>
+constexpr reserved_hash_layout make_reserved_hash_layout(const Trie& trie)
+{
+    reserved_hash_layout result{0, 0, 0};
+    visit_trie_strings(trie, [&](std::size_t, std::size_t length) {
+        if (length > result.max_length)
+            result.max_length = length;
+    });
+
+    for (auto length = 1u; length <= result.max_length; ++length)
+    {
+        auto count = std::size_t(0);
+        visit_trie_strings(trie, [&](std::size_t, std::size_t l) {
+            if (l == length)
+                ++count;
+        });
+        result.slot_count += reserved_hash_layout::bucket_size(count);
+    }
+
+    visit_trie_strings(trie, [&](std::size_t, std::size_t length) {
+        if (length * sizeof(typename Trie::char_type) > 2 * sizeof(swar_int))
+            result.pool_size += length;
+    });
+
+    return result;
+}
+
+// A hash set of the strings of a literal trie.
+// The strings are bucketed by length, so a lookup hashes and compares at most 16 bytes
+// for the common short strings.
+template <typename CharT, std::size_t MaxLength, std::size_t SlotCount, std::size_t PoolSize>
+struct reserved_hash_set
+{
+    struct bucket
+    {
+        std::size_t offset;
+        // The size of the table is a power of two, its mask is zero if it is empty.
+        std::size_t mask;
+        unsigned    shift;
+    };
+
+    struct slot
+    {
+        reserved_key key;
+        // Zero if the slot is empty, otherwise the index of the string in the pool plus one.
+        // Only strings longer than 16 bytes are stored in the pool, all others are one.
+        std::size_t string;
+    };
+
+    bucket buckets[MaxLength + 1];
+    slot   slots[SlotCount == 0 ? 1 : SlotCount];
+    CharT  pool[PoolSize == 0 ? 1 : PoolSize];
+
+    template <typename Trie>
+    LEXY_CONSTEVAL explicit reserved_hash_set(const Trie& trie) : buckets{}, slots{}, pool{}
+    {
+        std::size_t offset = 0, pool_offset = 0;
+        for (auto length = 1u; length <= MaxLength; ++length)
+        {
+            auto count = std::size_t(0);
+            visit_trie_strings(trie, [&](std::size_t, std::size_t l) {
+                if (l == length)
+                    ++count;
+            });
+
+            auto size = reserved_hash_layout::bucket_size(count);
+            auto bits = 0u;
+            while ((std::size_t(1) << bits) < size)
+                ++bits;
+            buckets[length] = {offset, size == 0 ? 0 : size - 1, 64 - bits};
+
+            visit_trie_strings(trie, [&](std::size_t node, std::size_t l) {
+                if (l != length)
+                    return;
+
+                CharT str[MaxLength == 0 ? 1 : MaxLength] = {};
+                for (auto idx = length; idx != 0; --idx)
+                {
+                    str[idx - 1] = trie.transition_char[node - 1];
+                    node         = trie.transition_from[node - 1];
+                }
+
+                auto key = make_reserved_key(str, length);
+                auto idx = std::size_t(reserved_hash(key) >> buckets[length].shift);
+                while (slots[offset + idx].string != 0)
+                    idx = (idx + 1) & buckets[length].mask;
+
+                auto& slot  = slots[offset + idx];
+                slot.key    = key;
+                slot.string = 1;
+                if (length * sizeof(CharT) > 2 * sizeof(swar_int))
+                {
+                    slot.string = pool_offset + 1;
+                    for (auto i = 0u; i != length; ++i)
+                        pool[pool_offset++] = str[i];
+                }
+            });
+
+            offset += size;
+        }
+    }
+
+    constexpr bool contains(const CharT* str, std::size_t length) const
+    {
+        if (length > MaxLength || buckets[length].mask == 0)
+            return false;
+
+        auto& bucket = buckets[length];
+        auto  key    = make_reserved_key(str, length);
+        for (auto idx = std::size_t(reserved_hash(key) >> bucket.shift);;
+             idx      = (idx + 1) & bucket.mask)
+        {
+            auto& slot = slots[bucket.offset + idx];
+            if (slot.string == 0)
+                return false;
+            else if (slot.key.head == key.head && slot.key.tail == key.tail
+                     && _compare_middle(str, slot.string - 1, length))
+                return true;
+        }
+    }
+
+    constexpr bool _compare_middle(const CharT* str, std::size_t string, std::size_t length) const
+    {
+        constexpr auto swar_size = sizeof(swar_int) / sizeof(CharT);
+        if (length <= 2 * swar_size)
+            // Head and tail already cover everything.
+            return true;
+
+        for (auto i = swar_size; i < length - swar_size; i += swar_size)
+            if (swar_load(str + i) != swar_load(pool + string + i))
+                return false;
+        return true;
+    }
+};
+
+template <const auto& Trie>
+constexpr auto reserved_hash_set_layout = make_reserved_hash_layout(Trie);
 
+template <const auto& Trie>
+constexpr auto reserved_hash_set_for = [] {
+    using trie_type        = std::remove_cv_t<std::remove_reference_t<decltype(Trie)>>;
+    using char_type        = typename trie_type::char_type;
+    constexpr auto& layout = reserved_hash_set_layout<Trie>;
+    return reserved_hash_set<char_type, layout.max_length, layout.slot_count, layout.pool_size>(
+        Trie);
+}();
+} // namespace lexy::_detail
+
+namespace lexyd
+{
 template <typename Set>
 struct _idrp // reserve predicate
 {
-    template <typename Input>
-    static constexpr bool is_reserved(const Input& input)
+    template <typename Reader>
+    static constexpr bool is_reserved([[maybe_unused]] const Reader& reader,
+                                      typename Reader::iterator begin,
+                                      typename Reader::iterator end)
     {
-        auto reader = input.reader();
-        return lexy::try_match_token(Set{}, reader)
-               && reader.peek() == decltype(reader)::encoding::eof();
+        using encoding  = typename Reader::encoding;
+        using trie_type = std::remove_cv_t<decltype(Set::as_lset::template _t<encoding>)>;
+
+        if constexpr (std::is_pointer_v<typename Reader::iterator>
+                      && trie_type::char_class_count == 0
+                      && std::is_same_v<typename trie_type::template reader<lexy::_pr8>,
+                                        lexy::_pr8>)
+        {
+            // Without case folding or keywords, we can look up the identifier in a hash set.
+            constexpr auto& set
+                = lexy::_detail::reserved_hash_set_for<Set::as_lset::template _t<encoding>>;
+            return set.contains(begin, static_cast<std::size_t>(end - begin));
+        }
+        else
+        {
+            auto input_reader = lexy::partial_input(reader, begin, end).reader();
+            return lexy::try_match_token(Set{}, input_reader)
+                   && input_reader.peek() == decltype(input_reader)::encoding::eof();
+        }
     }
 };
 template <typename Set>
 struct _idpp // reserve prefix predicate
 {
-    template <typename Input>
-    static constexpr bool is_reserved(const Input& input)
+    template <typename Reader>
+    static constexpr bool is_reserved(const Reader& reader, typename Reader::iterator begin,
+                                      typename Reader::iterator end)
     {
-        auto reader = input.reader();
-        return lexy::try_match_token(Set{}, reader);
+        auto input_reader = lexy::partial_input(reader, begin, end).reader();
+        return lexy::try_match_token(Set{}, input_reader);
     }
 };
 template <typename Set>
 struct _idcp // reserve contains predicate
 {
-    template <typename Input>
-    static constexpr bool is_reserved(const Input& input)
+    template <typename Reader>
+    static constexpr bool is_reserved(const Reader& reader, typename Reader::iterator begin,
+                                      typename Reader::iterator end)
     {
-        auto reader = input.reader();
+        auto input_reader = lexy::partial_input(reader, begin, end).reader();
         while (true)
         {
-            if (lexy::try_match_token(Set{}, reader))
+            if (lexy::try_match_token(Set{}, input_reader))
                 return true;
-            else if (reader.peek() == decltype(reader)::encoding::eof())
+            else if (input_reader.peek() == decltype(input_reader)::encoding::eof())
                 return false;
             else
-                reader.bump();
+                input_reader.bump();
         }
 
         // unreachable
@@ -119,19 +390,20 @@ struct _idcp // reserve contains predicate
 template <typename Set>
 struct _idsp // reserve suffix predicate
 {
-    template <typename Input>
-    static constexpr bool is_reserved(const Input& input)
+    template <typename Reader>
+    static constexpr bool is_reserved(const Reader& reader, typename Reader::iterator begin,
+                                      typename Reader::iterator end)
     {
-        auto reader = input.reader();
+        auto input_reader = lexy::partial_input(reader, begin, end).reader();
         while (true)
         {
-            if (lexy::try_match_token(Set{}, reader)
-                && reader.peek() == decltype(reader)::encoding::eof())
+            if (lexy::try_match_token(Set{}, input_reader)
+                && input_reader.peek() == decltype(input_reader)::encoding::eof())
                 return true;
-            else if (reader.peek() == decltype(reader)::encoding::eof())
+            else if (input_reader.peek() == decltype(input_reader)::encoding::eof())
                 return false;
             else
-                reader.bump();
+                input_reader.bump();
         }
 
         // unreachable
@@ -154,8 +426,7 @@ struct _id : branch_base
             auto end = reader.position();
 
             // Check for a reserved identifier.
-            [[maybe_unused]] auto input = lexy::partial_input(reader, begin, end);
-            if ((ReservedPredicate::is_reserved(input) || ...))
+            if ((ReservedPredicate::is_reserved(reader, begin, end) || ...))
             {
                 // It is reserved, report an error but trivially recover.
                 auto err = lexy::error<Reader, lexy::reserved_identifier>(begin, end);
@@ -183,9 +454,8 @@ struct _id : branch_base
             end = parser.end;
 
             // We only succeed if it's not a reserved identifier.
-            [[maybe_unused]] auto input
-                = lexy::partial_input(reader, reader.position(), end.position());
-            return !(ReservedPredicate::is_reserved(input) || ...);
+            return !(ReservedPredicate::is_reserved(reader, reader.position(), end.position())
+                     || ...);
         }
 
         template <typename Context>
@@ -234,6 +234,55 @@ constexpr bool _ndigits_can_overflow()
     return N >= max_digit_count;
 }
 
+// Whether we can convert blocks of eight digits at once using SWAR techniques.
+template <typename T, typename Base, typename Iterator>
+constexpr bool _can_swar_parse_digits = [] {
+    if constexpr (!std::is_pointer_v<Iterator>)
+        return false;
+    else
+    {
+        using char_type = std::remove_cv_t<std::remove_pointer_t<Iterator>>;
+        using type      = typename lexy::integer_traits<T>::type;
+        return sizeof(char_type) == 1 && lexy::_detail::swar_length<char_type> == 8
+               && std::is_integral_v<type> && sizeof(type) >= sizeof(std::uint_least32_t)
+               && Base::digit_radix <= 16;
+    }
+}();
+
+// Converts the next eight code units if they're all digits and advances cur.
+// The caller has to ensure that adding eight digits to value can't overflow.
+template <typename T, typename Base, typename Iterator>
+constexpr bool _swar_parse_digits(Iterator& cur, Iterator end,
+                                  typename lexy::integer_traits<T>::type& value)
+{
+    using lexy::_detail::swar_int;
+    using char_type      = std::remove_cv_t<std::remove_pointer_t<Iterator>>;
+    constexpr auto radix = swar_int(Base::digit_radix);
+
+    if (end - cur < 8)
+        return false;
+
+    auto block = lexy::_detail::swar_load<char_type>(cur);
+    // Note that this only accepts 0-9 for hex digits, but that's fine.
+    if (!Base::template swar_matches<char_type>(block))
+        return false;
+
+    // The first digit is in the lowest byte, so combine each byte with its neighbor,
+    // then each pair of bytes with its neighbor.
+    block &= 0x0F0F'0F0F'0F0F'0F0F;
+    block = (block * radix + (block >> 8)) & 0x00FF'00FF'00FF'00FF;
+    block = (block * radix * radix + (block >> 16)) & 0x0000'FFFF'0000'FFFF;
+
+    // The lower half contains the value of the first four digits, the upper half of the rest.
+    constexpr auto radix4 = int(radix * radix * radix * radix);
+    using traits          = lexy::integer_traits<T>;
+    traits::template add_digit_unchecked<radix4>(value, unsigned(block & 0xFFFF'FFFF));
+    traits::template add_digit_unchecked<radix4>(value, unsigned(block >> 32));
+
+    cur += 8;
+    return true;
+}
+
 // Parses T in the Base without checking for overflow.
 template <typename T, typename Base>
 struct _unbounded_integer_parser
@@ -257,6 +306,12 @@ struct _unbounded_integer_parser
         // Just parse digits until we've run out of digits.
         while (cur != end)
         {
+            if constexpr (_can_swar_parse_digits<T, Base, Iterator>)
+            {
+                if (_swar_parse_digits<T, Base>(cur, end, value))
+                    continue;
+            }
+
             auto digit = Base::digit_value(*cur++);
             if (digit >= Base::digit_radix)
                 // Skip digit separator.
@@ -306,9 +361,18 @@ struct _bounded_integer_parser
         // At this point, we've parsed exactly one non-zero digit, so we can assign.
         auto value = typename traits::type(first_digit);
 
+        // Convert blocks of eight digits as long as they can't overflow.
+        std::size_t digit_count = 1;
+        if constexpr (max_digit_count > 9 && _can_swar_parse_digits<T, Base, Iterator>)
+        {
+            while (digit_count + 8 < max_digit_count
+                   && _swar_parse_digits<T, Base>(cur, end, value))
+                digit_count += 8;
+        }
+
         // Handle at most the number of remaining digits.
-        // Due to the fixed loop count, it is most likely unrolled.
-        for (std::size_t digit_count = 1; digit_count < max_digit_count; ++digit_count)
+        // Due to the bounded loop count, it is most likely unrolled.
+        for (; digit_count < max_digit_count; ++digit_count)
         {
             // Find the next digit.
             auto digit = 0u;
@@ -15,6 +15,41 @@
 //=== lit_matcher ===//
 namespace lexy::_detail
 {
+// Whether the reader is a case folding reader that converts uppercase ASCII letters to lowercase
+// and wraps a SWAR reader in its `_impl` member.
+// A literal without uppercase letters can then be matched in SWAR:
+// setting the case bit of the input on all positions where the literal has a letter is the same
+// as converting the input to lowercase.
+template <typename Reader>
+constexpr auto is_swar_ascii_case_folding_reader = false;
+
+template <typename CharT>
+constexpr bool is_ascii_upper(CharT c)
+{
+    return CharT('A') <= c && c <= CharT('Z');
+}
+
+// The bit that needs to be set in the input to match c case insensitively.
+template <typename CharT>
+constexpr CharT ascii_case_bit(CharT c)
+{
+    return CharT('a') <= c && c <= CharT('z') ? CharT('a' - 'A') : CharT(0);
+}
+
+template <typename Reader>
+constexpr auto& swar_impl_reader(Reader& reader)
+{
+    if constexpr (is_swar_ascii_case_folding_reader<Reader>)
+        return reader._impl;
+    else
+        return reader;
+}
+
+template <typename Reader, typename CharT, CharT... Cs>
+constexpr auto can_match_swar
+    = is_swar_reader<Reader>
+      || (is_swar_ascii_case_folding_reader<Reader> && (!is_ascii_upper(Cs) && ...));
+
 template <std::size_t CurCharIndex, typename CharT, CharT... Cs, typename Reader>
 constexpr auto match_literal(Reader& reader)
 {
@@ -26,24 +61,35 @@ constexpr auto match_literal(Reader& reader)
         return std::true_type{};
     }
     // We only use SWAR if the reader supports it and we have enough to fill at least one.
-    else if constexpr (is_swar_reader<Reader> && sizeof...(Cs) >= swar_length<char_type>)
+    // With case folding, comparing each character is more expensive, so we use it earlier.
+    else if constexpr (can_match_swar<Reader, CharT, Cs...>
+                       && sizeof...(Cs) >= (is_swar_ascii_case_folding_reader<Reader>
+                                                ? 2
+                                                : swar_length<char_type>))
     {
         // Try and pack as many characters into a swar as possible, starting at the current
         // index.
         constexpr auto pack = swar_pack<CurCharIndex>(transcode_char<char_type>(Cs)...);
+        // For case folding, these bits are set in the input before comparing.
+        constexpr auto fold
+            = is_swar_ascii_case_folding_reader<Reader>
+                  ? swar_pack<CurCharIndex>(ascii_case_bit(transcode_char<char_type>(Cs))...).value
+                  : swar_int(0);
 
         // Do a single swar comparison.
-        if ((reader.peek_swar() & pack.mask) == pack.value)
+        auto& swar_reader = swar_impl_reader(reader);
+        auto  cur         = (swar_reader.peek_swar() | fold) & pack.mask;
+        if (cur == pack.value)
         {
-            reader.bump_swar(pack.count);
+            swar_reader.bump_swar(pack.count);
 
             // Recurse with the incremented index.
             return bool(match_literal<CurCharIndex + pack.count, CharT, Cs...>(reader));
         }
         else
         {
-            auto partial = swar_find_difference<CharT>(reader.peek_swar() & pack.mask, pack.value);
-            reader.bump_swar(partial);
+            auto partial = swar_find_difference<CharT>(cur, pack.value);
+            swar_reader.bump_swar(partial);
             return false;
         }
     }
@@ -73,6 +119,8 @@ struct lit_trie
     template <typename Reader>
     using reader = CaseFolding<Reader>;
 
+    static constexpr auto char_class_count = sizeof...(CharClasses);
+
     static constexpr auto max_node_count = MaxCharCount + 1; // root node
     static constexpr auto max_transition_count
         = max_node_count == 1 ? 1 : max_node_count - 1; // it is a tree
@@ -236,6 +284,42 @@ template <std::size_t CharClassIdx, typename... CharClasses>
 using _node_char_class
     = _node_char_class_impl<CharClassIdx, (CharClassIdx < sizeof...(CharClasses)), CharClasses...>;
 
+// A chain of nodes that have a single transition and no value, starting at some node.
+// They can be matched at once using SWAR.
+struct lit_trie_chain
+{
+    swar_int    value, mask, fold;
+    std::size_t length;
+    std::size_t end;
+    bool        has_upper;
+};
+
+template <typename Trie>
+LEXY_CONSTEVAL lit_trie_chain make_lit_trie_chain(const Trie& trie, std::size_t node)
+{
+    using char_type = typename Trie::char_type;
+
+    lit_trie_chain result{0, 0, 0, 0, node, false};
+    while (result.length < swar_length<char_type> && trie.node_value[node] == trie.node_no_match)
+    {
+        auto transitions = trie.node_transitions(node);
+        if (transitions.length != 1)
+            break;
+
+        auto c     = trie.transition_char[transitions.index[0]];
+        auto shift = result.length * char_bit_size<char_type>;
+        result.value |= swar_int(make_uchar(c)) << shift;
+        result.mask |= swar_int(make_uchar(char_type(-1))) << shift;
+        result.fold |= swar_int(make_uchar(ascii_case_bit(c))) << shift;
+        result.has_upper = result.has_upper || is_ascii_upper(c);
+
+        ++result.length;
+        node = trie.transition_to[transitions.index[0]];
+    }
+    result.end = node;
+    return result;
+}
+
 template <const auto& Trie, std::size_t CurNode>
 struct lit_trie_matcher;
 template <typename Encoding, template <typename> typename CaseFolding, std::size_t N,
@@ -255,11 +339,19 @@ struct lit_trie_matcher<Trie, CurNode>
             return false;
 
         reader.bump();
-        result = lit_trie_matcher<Trie, Trie.transition_to[TransIdx]>::try_match(reader);
+        result = lit_trie_matcher<Trie, Trie.transition_to[TransIdx]>::template _impl<>::try_match(
+            reader);
         return true;
     }
 
     static constexpr auto transitions = Trie.node_transitions(CurNode);
+    static constexpr auto chain       = make_lit_trie_chain(Trie, CurNode);
+
+    template <typename Reader>
+    static constexpr auto _can_match_chain
+        = chain.length > 1
+          && (is_swar_reader<Reader>
+              || (is_swar_ascii_case_folding_reader<Reader> && !chain.has_upper));
 
     template <typename Indices = make_index_sequence<transitions.length>>
     struct _impl;
@@ -271,7 +363,27 @@ struct lit_trie_matcher<Trie, CurNode>
         {
             constexpr auto cur_value = Trie.node_value[CurNode];
 
-            if constexpr (sizeof...(Idx) > 0)
+            if constexpr (_can_match_chain<Reader>)
+            {
+                // We don't have a value, so the entire chain needs to match.
+                constexpr auto fold = is_swar_ascii_case_folding_reader<Reader> ? chain.fold : 0;
+
+                auto  cur         = reader.current();
+                auto& swar_reader = swar_impl_reader(reader);
+                if (((swar_reader.peek_swar() | fold) & chain.mask) == chain.value)
+                {
+                    swar_reader.bump_swar(chain.length);
+
+                    auto result = lit_trie_matcher<Trie, chain.end>::template _impl<>::try_match(
+                        reader);
+                    if (result != Trie.node_no_match)
+                        return result;
+                }
+
+                reader.reset(cur);
+                return Trie.node_no_match;
+            }
+            else if constexpr (sizeof...(Idx) > 0)
             {
                 auto cur      = reader.current();
                 auto cur_char = reader.peek();
@@ -545,12 +657,21 @@ struct _lset : token_base<_lset<Literals...>>, _lset_base
 
         constexpr bool try_parse(Reader reader)
         {
-            using encoding = typename Reader::encoding;
-            using matcher  = lexy::_detail::lit_trie_matcher<_t<encoding>, 0>;
+            if constexpr (sizeof...(Literals) == 0)
+            {
+                // The empty set never matches, which also makes it usable with node inputs,
+                // e.g. as the default recovery limit.
+                return false;
+            }
+            else
+            {
+                using encoding = typename Reader::encoding;
+                using matcher  = lexy::_detail::lit_trie_matcher<_t<encoding>, 0>;
 
-            auto result = matcher::try_match(reader);
-            end         = reader.current();
-            return result != _t<encoding>.node_no_match;
+                auto result = matcher::try_match(reader);
+                end         = reader.current();
+                return result != _t<encoding>.node_no_match;
+            }
         }
 
         template <typename Context>
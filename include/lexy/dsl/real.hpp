@@ -0,0 +1,111 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_DSL_REAL_HPP_INCLUDED
+#define LEXY_DSL_REAL_HPP_INCLUDED
+
+#include <lexy/_detail/float.hpp>
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/integer.hpp>
+#include <lexy/dsl/literal.hpp>
+
+namespace lexyd
+{
+template <typename T>
+struct _real_parser
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "only float and double are supported");
+
+    using base = decimal;
+
+    struct result_type
+    {
+        T               value;
+        std::false_type overflow;
+    };
+
+    template <typename Iterator>
+    static constexpr result_type parse(Iterator cur, Iterator end)
+    {
+        // Values that are too big become infinity, values that are too small become zero.
+        return {lexy::_detail::parse_float<T>(cur, end), {}};
+    }
+};
+
+// digits [. digits] [(e|E) [+|-] digits]
+struct _real_token : token_base<_real_token>
+{
+    template <typename Reader>
+    static constexpr bool _match(Reader& reader)
+    {
+        if (!_match_digits<decimal>(reader))
+            return false;
+
+        // The fraction and exponent are all-or-nothing:
+        // if they're not followed by digits, the number ends before them.
+        auto fraction = reader.current();
+        if (lexy::try_match_token(lit_c<'.'>, reader) && !_match_digits<decimal>(reader))
+            reader.reset(fraction);
+
+        auto exponent = reader.current();
+        if (lexy::try_match_token(lit_c<'e'>, reader) || lexy::try_match_token(lit_c<'E'>, reader))
+        {
+            if (!lexy::try_match_token(lit_c<'-'>, reader))
+                lexy::try_match_token(lit_c<'+'>, reader);
+
+            if (!_match_digits<decimal>(reader))
+                reader.reset(exponent);
+        }
+
+        return true;
+    }
+
+    template <typename Reader>
+    struct tp
+    {
+        typename Reader::marker end;
+
+        constexpr explicit tp(const Reader& reader) : end(reader.current()) {}
+
+        constexpr bool try_parse(Reader reader)
+        {
+            auto result = _match(reader);
+            end         = reader.current();
+            return result;
+        }
+
+        template <typename Context>
+        constexpr void report_error(Context& context, const Reader&)
+        {
+            auto err = lexy::error<Reader, lexy::expected_char_class>(end.position(),
+                                                                      decimal::char_class_name());
+            context.on(_ev::error{}, err);
+        }
+    };
+};
+
+template <typename T>
+struct _real_dsl : _int<_real_token, _real_parser<T>, void>
+{
+    template <typename Token>
+    constexpr auto operator()(Token) const
+    {
+        static_assert(lexy::is_token_rule<Token>);
+        return _int<Token, _real_parser<T>, void>{};
+    }
+};
+
+/// Parses a decimal number with optional fraction and exponent into a floating point type.
+template <typename T>
+constexpr auto real = _real_dsl<T>{};
+} // namespace lexyd
+
+namespace lexy
+{
+template <>
+constexpr auto token_kind_of<lexy::dsl::_real_token> = lexy::digits_token_kind;
+} // namespace lexy
+
+#endif // LEXY_DSL_REAL_HPP_INCLUDED
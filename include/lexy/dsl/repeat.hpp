@@ -99,6 +99,14 @@ struct _repl : rule_base // repeat, list
                                            Args&&... args)
         {
             auto sink = context.value_callback().sink();
+            if constexpr (lexy::_has_reserve<decltype(sink)>
+                          && lexy::_detail::is_bulk_reader<Reader>)
+            {
+                // The count comes from the input, so we can't trust it.
+                // Reserving at most the remaining input keeps the allocation bounded.
+                auto remaining = reader.remaining();
+                sink.reserve(count < remaining ? count : remaining);
+            }
             if (!_rep_impl<Item, Sep>::loop(context, reader, count, sink))
                 return false;
 
@@ -0,0 +1,544 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_DSL_TOKEN_DFA_HPP_INCLUDED
+#define LEXY_DSL_TOKEN_DFA_HPP_INCLUDED
+
+#include <cstdint>
+#include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
+#include <lexy/dsl/char_class.hpp>
+#include <lexy/dsl/choice.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/identifier.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/loop.hpp>
+#include <lexy/dsl/option.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/dsl/token.hpp>
+
+//=== position automaton ===//
+namespace lexy::_detail
+{
+template <std::size_t N>
+struct dfa_bitset
+{
+    static constexpr auto word_count = N == 0 ? 1 : (N + 63) / 64;
+    std::uint_least64_t   words[word_count];
+
+    constexpr dfa_bitset() : words{} {}
+
+    constexpr bool empty() const
+    {
+        for (auto word : words)
+            if (word != 0)
+                return false;
+        return true;
+    }
+    constexpr bool contains(std::size_t idx) const
+    {
+        return ((words[idx / 64] >> (idx % 64)) & 1) != 0;
+    }
+
+    constexpr void insert(std::size_t idx)
+    {
+        words[idx / 64] |= std::uint_least64_t(1) << (idx % 64);
+    }
+    constexpr void insert(const dfa_bitset& other)
+    {
+        for (auto i = 0u; i != word_count; ++i)
+            words[i] |= other.words[i];
+    }
+
+    constexpr dfa_bitset intersection(const dfa_bitset& other) const
+    {
+        auto result = *this;
+        for (auto i = 0u; i != word_count; ++i)
+            result.words[i] &= other.words[i];
+        return result;
+    }
+
+    friend constexpr bool operator==(const dfa_bitset& lhs, const dfa_bitset& rhs)
+    {
+        for (auto i = 0u; i != word_count; ++i)
+            if (lhs.words[i] != rhs.words[i])
+                return false;
+        return true;
+    }
+};
+
+// The position (or Glushkov) automaton of a regular expression over code units.
+// Every character set in the expression is a state, which is entered by matching one of its code
+// units. State 0 is the start state.
+template <std::size_t Positions>
+struct position_automaton
+{
+    using set = dfa_bitset<Positions + 1>;
+
+    struct fragment
+    {
+        bool nullable;
+        set  first, last;
+    };
+
+    dfa_bitset<256> chars[Positions + 1];
+    set             follow[Positions + 1];
+    set             accepting;
+    std::size_t     size;
+
+    constexpr position_automaton() : chars{}, follow{}, accepting{}, size(1) {}
+
+    constexpr fragment empty() const
+    {
+        return {true, {}, {}};
+    }
+
+    constexpr fragment atom(const dfa_bitset<256>& cs)
+    {
+        auto pos   = size++;
+        chars[pos] = cs;
+
+        fragment result{false, {}, {}};
+        result.first.insert(pos);
+        result.last.insert(pos);
+        return result;
+    }
+
+    constexpr fragment sequence(const fragment& lhs, const fragment& rhs)
+    {
+        _connect(lhs.last, rhs.first);
+
+        fragment result{lhs.nullable && rhs.nullable, lhs.first, rhs.last};
+        if (lhs.nullable)
+            result.first.insert(rhs.first);
+        if (rhs.nullable)
+            result.last.insert(lhs.last);
+        return result;
+    }
+
+    constexpr fragment alternative(const fragment& lhs, const fragment& rhs) const
+    {
+        fragment result{lhs.nullable || rhs.nullable, lhs.first, lhs.last};
+        result.first.insert(rhs.first);
+        result.last.insert(rhs.last);
+        return result;
+    }
+
+    constexpr fragment repetition(const fragment& f)
+    {
+        _connect(f.last, f.first);
+        return {true, f.first, f.last};
+    }
+
+    constexpr void finish(const fragment& f)
+    {
+        follow[0] = f.first;
+        accepting = f.last;
+        if (f.nullable)
+            accepting.insert(0);
+    }
+
+    constexpr void _connect(const set& from, const set& to)
+    {
+        for (auto pos = 0u; pos != size; ++pos)
+            if (from.contains(pos))
+                follow[pos].insert(to);
+    }
+};
+
+// Partitions the code units into classes that enter the same positions.
+template <std::size_t Positions>
+struct dfa_byte_classes
+{
+    unsigned char             class_of[256];
+    dfa_bitset<Positions + 1> positions[256];
+    std::size_t               count;
+
+    constexpr explicit dfa_byte_classes(const position_automaton<Positions>& automaton)
+    : class_of{}, positions{}, count(0)
+    {
+        for (auto c = 0u; c != 256; ++c)
+        {
+            dfa_bitset<Positions + 1> entered;
+            for (auto pos = 1u; pos != automaton.size; ++pos)
+                if (automaton.chars[pos].contains(c))
+                    entered.insert(pos);
+
+            auto idx = 0u;
+            while (idx != count && !(positions[idx] == entered))
+                ++idx;
+            if (idx == count)
+                positions[count++] = entered;
+
+            class_of[c] = static_cast<unsigned char>(idx);
+        }
+    }
+};
+
+// The subset construction: every state of the DFA is a set of states of the position
+// automaton. State 0 is the dead state, state 1 the start state.
+template <std::size_t Capacity, std::size_t Positions>
+struct dfa_subsets
+{
+    dfa_bitset<Positions + 1> states[Capacity];
+    std::size_t               count;
+
+    template <typename Fn>
+    constexpr dfa_subsets(const position_automaton<Positions>& automaton,
+                          const dfa_byte_classes<Positions>& classes, Fn transition)
+    : states{}, count(2)
+    {
+        states[1].insert(0);
+
+        for (auto state = 1u; state < count; ++state)
+        {
+            dfa_bitset<Positions + 1> next;
+            for (auto pos = 0u; pos != automaton.size; ++pos)
+                if (states[state].contains(pos))
+                    next.insert(automaton.follow[pos]);
+
+            for (auto cls = 0u; cls != classes.count; ++cls)
+            {
+                auto target = next.intersection(classes.positions[cls]);
+                if (target.empty())
+                {
+                    transition(state, cls, 0u);
+                    continue;
+                }
+
+                auto idx = 1u;
+                while (idx != count && !(states[idx] == target))
+                    ++idx;
+                if (idx == count)
+                {
+                    if (count == Capacity)
+                    {
+                        // Too many states, the caller has to check.
+                        count = Capacity + 1;
+                        return;
+                    }
+                    states[count++] = target;
+                }
+
+                transition(state, cls, idx);
+            }
+        }
+    }
+};
+
+template <std::size_t States, std::size_t Classes>
+struct token_dfa
+{
+    // A state is stored as the offset of its row in the transition table, the dead state is 0.
+    // The accepting states are last, so a single comparison checks whether a state is accepting.
+    using state_type = std::conditional_t<(States * Classes <= 0xFF), unsigned char,
+                                          std::conditional_t<(States * Classes <= 0xFFFF),
+                                                             std::uint_least16_t,
+                                                             std::uint_least32_t>>;
+
+    unsigned char class_of[256];
+    state_type    transitions[States * Classes];
+    state_type    start;
+    state_type    first_accepting;
+    // Whether the code unit 0xFF can be part of a match; otherwise, an EOF of 0xFF is dead.
+    bool matches_ff;
+
+    constexpr token_dfa()
+    : class_of{}, transitions{}, start(0), first_accepting(0), matches_ff(false)
+    {}
+};
+} // namespace lexy::_detail
+
+//=== lowering ===//
+namespace lexyd
+{
+// Lowers a rule to a regular expression in the position automaton.
+template <typename Rule, typename = void>
+struct _tdfa_re
+{
+    static_assert(lexy::_detail::error<Rule>,
+                  "dsl::token_dfa() only supports literals, ASCII char classes, sequences, "
+                  "choices, opt(), while_(), identifier() without reserved words, digits<>, "
+                  "and token()");
+};
+
+template <typename... R>
+struct _tdfa_seq
+{
+    static constexpr std::size_t positions = (0 + ... + _tdfa_re<R>::positions);
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        auto result = automaton.empty();
+        ((result = automaton.sequence(result, _tdfa_re<R>::build(automaton))), ...);
+        return result;
+    }
+};
+
+template <typename... R>
+struct _tdfa_alt
+{
+    static constexpr std::size_t positions = (0 + ... + _tdfa_re<R>::positions);
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        // An empty choice never matches, which is the same as an alternative of nothing.
+        typename Automaton::fragment result{false, {}, {}};
+        ((result = automaton.alternative(result, _tdfa_re<R>::build(automaton))), ...);
+        return result;
+    }
+};
+
+template <typename CharClass>
+struct _tdfa_re<CharClass, std::enable_if_t<lexy::is_char_class_rule<CharClass>>>
+{
+    static_assert(std::is_same_v<decltype(CharClass::char_class_match_cp(char32_t())),
+                                 std::false_type>,
+                  "dsl::token_dfa() only supports ASCII char classes");
+
+    static constexpr std::size_t positions = 1;
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        lexy::_detail::dfa_bitset<256> chars;
+        CharClass::char_class_ascii().visit([&](int c) { chars.insert(std::size_t(c)); });
+        return automaton.atom(chars);
+    }
+};
+
+template <typename CharT, CharT... C>
+struct _tdfa_re<_lit<CharT, C...>>
+{
+    static_assert(((sizeof(CharT) == 1 || C <= 0x7F) && ...),
+                  "dsl::token_dfa() only supports ASCII literals for multi-byte character types");
+
+    static constexpr std::size_t positions = sizeof...(C);
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        auto atom = [&](CharT c) {
+            lexy::_detail::dfa_bitset<256> chars;
+            chars.insert(static_cast<unsigned char>(c));
+            return automaton.atom(chars);
+        };
+
+        auto result = automaton.empty();
+        ((result = automaton.sequence(result, atom(C))), ...);
+        return result;
+    }
+};
+
+template <typename... Literals>
+struct _tdfa_re<_lset<Literals...>> : _tdfa_alt<Literals...>
+{};
+
+template <typename... R>
+struct _tdfa_re<_seq<R...>> : _tdfa_seq<R...>
+{};
+template <typename Condition, typename... R>
+struct _tdfa_re<_br<Condition, R...>> : _tdfa_seq<Condition, R...>
+{};
+template <typename... R>
+struct _tdfa_re<_chc<R...>> : _tdfa_alt<R...>
+{};
+
+template <typename Branch>
+struct _tdfa_re<_opt<Branch>>
+{
+    static constexpr std::size_t positions = _tdfa_re<Branch>::positions;
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        return automaton.alternative(_tdfa_re<Branch>::build(automaton), automaton.empty());
+    }
+};
+
+template <typename Branch>
+struct _tdfa_re<_whl<Branch>>
+{
+    static constexpr std::size_t positions = _tdfa_re<Branch>::positions;
+
+    template <typename Automaton>
+    static constexpr auto build(Automaton& automaton)
+    {
+        return automaton.repetition(_tdfa_re<Branch>::build(automaton));
+    }
+};
+
+template <typename Leading, typename Trailing>
+struct _tdfa_re<_idp<Leading, Trailing>> : _tdfa_seq<Leading, _whl<Trailing>>
+{};
+// Identifiers with reserved words can't be checked by the DFA;
+// they don't match this specialization and are rejected through the primary template.
+template <typename Leading, typename Trailing>
+struct _tdfa_re<_id<Leading, Trailing>> : _tdfa_seq<Leading, _whl<Trailing>>
+{};
+template <typename Base>
+struct _tdfa_re<_digits<Base>> : _tdfa_seq<Base, _whl<Base>>
+{};
+
+template <typename Rule>
+struct _tdfa_re<_token<Rule>> : _tdfa_re<Rule>
+{};
+// Char classes are already handled above.
+template <auto Kind, typename Token>
+struct _tdfa_re<_tokk<Kind, Token>, std::enable_if_t<!lexy::is_char_class_rule<Token>>>
+: _tdfa_re<Token>
+{};
+template <typename Tag, typename Token>
+struct _tdfa_re<_toke<Tag, Token>, std::enable_if_t<!lexy::is_char_class_rule<Token>>>
+: _tdfa_re<Token>
+{};
+
+template <typename Rule>
+LEXY_CONSTEVAL auto _tdfa_make_automaton()
+{
+    lexy::_detail::position_automaton<_tdfa_re<Rule>::positions> result;
+    result.finish(_tdfa_re<Rule>::build(result));
+    return result;
+}
+
+template <typename Rule>
+constexpr auto _tdfa_automaton = _tdfa_make_automaton<Rule>();
+template <typename Rule>
+constexpr auto _tdfa_classes = lexy::_detail::dfa_byte_classes(_tdfa_automaton<Rule>);
+template <typename Rule>
+constexpr auto _tdfa_state_count
+    = lexy::_detail::dfa_subsets<1024, _tdfa_re<Rule>::positions>(_tdfa_automaton<Rule>,
+                                                                 _tdfa_classes<Rule>,
+                                                                 [](auto, auto, auto) {})
+          .count;
+
+template <typename Rule>
+LEXY_CONSTEVAL auto _tdfa_build()
+{
+    constexpr auto& automaton   = _tdfa_automaton<Rule>;
+    constexpr auto& classes     = _tdfa_classes<Rule>;
+    constexpr auto  state_count = _tdfa_state_count<Rule>;
+    static_assert(state_count <= 1024, "token is too complex for dsl::token_dfa()");
+
+    std::size_t transitions[state_count * classes.count] = {};
+    auto        subsets = lexy::_detail::dfa_subsets<state_count, _tdfa_re<Rule>::positions>(
+        automaton, classes, [&](std::size_t state, std::size_t cls, std::size_t target) {
+            transitions[state * classes.count + cls] = target;
+        });
+
+    // Renumber the states, so that the accepting ones are last.
+    bool accepting[state_count] = {};
+    for (auto state = 1u; state != state_count; ++state)
+        accepting[state] = !subsets.states[state].intersection(automaton.accepting).empty();
+
+    std::size_t order[state_count] = {};
+    auto        count              = 1u;
+    for (auto pass = 0; pass != 2; ++pass)
+        for (auto state = 1u; state != state_count; ++state)
+            if (accepting[state] == (pass == 1))
+                order[state] = count++;
+
+    lexy::_detail::token_dfa<state_count, classes.count> result;
+    using state_type = typename decltype(result)::state_type;
+    auto offset      = [&](std::size_t state) {
+        return static_cast<state_type>(order[state] * classes.count);
+    };
+
+    for (auto c = 0u; c != 256; ++c)
+        result.class_of[c] = classes.class_of[c];
+    for (auto state = 1u; state != state_count; ++state)
+        for (auto cls = 0u; cls != classes.count; ++cls)
+        {
+            auto target = transitions[state * classes.count + cls];
+            result.transitions[offset(state) + cls] = offset(target);
+        }
+
+    result.start           = offset(1);
+    result.first_accepting = state_type(state_count * classes.count);
+    for (auto state = 1u; state != state_count; ++state)
+        if (accepting[state] && offset(state) < result.first_accepting)
+            result.first_accepting = offset(state);
+    result.matches_ff = !classes.positions[classes.class_of[0xFF]].empty();
+
+    return result;
+}
+
+template <typename Rule>
+constexpr auto _tdfa_table = _tdfa_build<Rule>();
+
+template <typename Rule>
+struct _tdfa : token_base<_tdfa<Rule>>
+{
+    template <typename Reader>
+    struct tp
+    {
+        typename Reader::marker end;
+
+        constexpr explicit tp(const Reader& reader) : end(reader.current()) {}
+
+        constexpr bool try_parse(Reader reader)
+        {
+            using encoding = typename Reader::encoding;
+            static_assert(lexy::is_char_encoding<encoding>);
+            constexpr auto& dfa = _tdfa_table<Rule>;
+
+            // If the EOF value is a code unit that can't be matched, we don't need to check it.
+            constexpr auto check_eof = sizeof(typename encoding::char_type) > 1 || dfa.matches_ff
+                                       || static_cast<unsigned char>(encoding::eof()) != 0xFF;
+
+            // Find the longest match.
+            auto state  = dfa.start;
+            auto result = state >= dfa.first_accepting;
+            while (true)
+            {
+                auto c = reader.peek();
+                if constexpr (sizeof(typename encoding::char_type) > 1)
+                {
+                    if (c < 0 || c > 0xFF)
+                        break;
+                }
+                else if constexpr (check_eof)
+                {
+                    if (c == encoding::eof())
+                        break;
+                }
+
+                state = dfa.transitions[state + dfa.class_of[static_cast<unsigned char>(c)]];
+                if (state == 0)
+                    break;
+
+                reader.bump();
+                if (state >= dfa.first_accepting)
+                {
+                    end    = reader.current();
+                    result = true;
+                }
+            }
+
+            if (!result)
+                end = reader.current();
+            return result;
+        }
+
+        template <typename Context>
+        constexpr void report_error(Context& context, const Reader& reader)
+        {
+            auto err = lexy::error<Reader, lexy::missing_token>(reader.position(), end.position());
+            context.on(_ev::error{}, err);
+        }
+    };
+};
+
+/// Turns the rule into a token that is matched by a DFA computed at compile-time.
+/// The rule may only consist of literals, ASCII char classes, sequences, choices, `opt()`, and
+/// `while_()`; it is matched as the equivalent regular expression, i.e. the longest match wins.
+template <typename Rule>
+constexpr auto token_dfa(Rule)
+{
+    return _tdfa<Rule>{};
+}
+} // namespace lexyd
+
+#endif // LEXY_DSL_TOKEN_DFA_HPP_INCLUDED
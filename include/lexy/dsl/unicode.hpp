@@ -237,6 +237,12 @@ struct _alpha : char_class_base<_alpha>
         return lexy::_detail::code_point_has_properties<LEXY_UNICODE_PROPERTY(alphabetic)>(cp);
     }
 
+    template <typename Reader>
+    static LEXY_UNICODE_CONSTEXPR bool char_class_match_utf8(Reader& reader)
+    {
+        return lexy::_detail::utf8_dfa_match<LEXY_UNICODE_PROPERTY(alphabetic)>(reader);
+    }
+
     template <typename Encoding>
     static constexpr auto char_class_match_swar(lexy::_detail::swar_int c)
     {
@@ -432,6 +438,12 @@ struct _xid_start : char_class_base<_xid_start>
         return lexy::_detail::code_point_has_properties<LEXY_UNICODE_PROPERTY(xid_start)>(cp);
     }
 
+    template <typename Reader>
+    static LEXY_UNICODE_CONSTEXPR bool char_class_match_utf8(Reader& reader)
+    {
+        return lexy::_detail::utf8_dfa_match<LEXY_UNICODE_PROPERTY(xid_start)>(reader);
+    }
+
     template <typename Encoding>
     static constexpr auto char_class_match_swar(lexy::_detail::swar_int c)
     {
@@ -458,6 +470,12 @@ struct _xid_start_underscore : char_class_base<_xid_start_underscore>
         return lexy::_detail::code_point_has_properties<LEXY_UNICODE_PROPERTY(xid_start)>(cp);
     }
 
+    template <typename Reader>
+    static LEXY_UNICODE_CONSTEXPR bool char_class_match_utf8(Reader& reader)
+    {
+        return lexy::_detail::utf8_dfa_match<LEXY_UNICODE_PROPERTY(xid_start)>(reader);
+    }
+
     template <typename Encoding>
     static constexpr auto char_class_match_swar(lexy::_detail::swar_int c)
     {
@@ -484,6 +502,12 @@ struct _xid_continue : char_class_base<_xid_continue>
         return lexy::_detail::code_point_has_properties<LEXY_UNICODE_PROPERTY(xid_continue)>(cp);
     }
 
+    template <typename Reader>
+    static LEXY_UNICODE_CONSTEXPR bool char_class_match_utf8(Reader& reader)
+    {
+        return lexy::_detail::utf8_dfa_match<LEXY_UNICODE_PROPERTY(xid_continue)>(reader);
+    }
+
     template <typename Encoding>
     static constexpr auto char_class_match_swar(lexy::_detail::swar_int c)
     {
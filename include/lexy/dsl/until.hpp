@@ -16,19 +16,19 @@ template <typename Condition, typename Reader>
 constexpr void _until_swar([[maybe_unused]] Reader& reader)
 {
     if constexpr (std::is_same_v<Condition, _nl> //
-                  && lexy::_detail::is_swar_reader<Reader>)
+                  && lexy::_detail::has_swar<Reader>)
     {
         // We use SWAR to skip characters until we have one that is <= 0xF or EOF.
         // Then we need to inspect it in more detail.
         using char_type = typename Reader::encoding::char_type;
 
-        while (true)
+        while (lexy::_detail::swar_available(reader))
         {
-            auto cur = reader.peek_swar();
-            if (lexy::_detail::swar_has_char<char_type, Reader::encoding::eof()>(cur)
+            auto cur = lexy::_detail::peek_swar(reader);
+            if (lexy::_detail::swar_has_char<char_type, char_type(Reader::encoding::eof())>(cur)
                 || lexy::_detail::swar_has_char_less<char_type, 0xF>(cur))
                 break;
-            reader.bump_swar();
+            lexy::_detail::bump_swar(reader);
         }
     }
 }
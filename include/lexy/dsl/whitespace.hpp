@@ -7,6 +7,8 @@
 #include <lexy/_detail/swar.hpp>
 #include <lexy/action/base.hpp>
 #include <lexy/dsl/base.hpp>
+#include <lexy/dsl/branch.hpp>
+#include <lexy/dsl/char_class.hpp>
 #include <lexy/dsl/choice.hpp>
 #include <lexy/dsl/loop.hpp>
 #include <lexy/dsl/token.hpp>
@@ -108,6 +110,84 @@ constexpr bool space_is_definitely_whitespace()
         return false;
 }
 
+// Whether we can skip the ASCII characters of the char class in SWAR blocks.
+template <typename CharClass, typename Reader>
+constexpr bool can_skip_ascii_swar = [] {
+    if constexpr (_detail::has_swar<Reader> && lexy::is_char_class_rule<CharClass>)
+        // EOF must never be part of the set.
+        return make_uchar(typename Reader::encoding::char_type(Reader::encoding::eof())) > 0x7F;
+    else
+        return false;
+}();
+
+// Skips all ASCII characters of the char class until the next character that isn't.
+template <typename CharClass, typename Reader>
+constexpr void skip_ascii_swar(Reader& reader)
+{
+    using encoding  = typename Reader::encoding;
+    using char_type = typename encoding::char_type;
+    using matcher   = ascii_set_matcher<lexyd::_cas<CharClass>>;
+
+    while (swar_available(reader))
+    {
+        auto match    = matcher::template match_swar<encoding>(peek_swar(reader));
+        auto mismatch = swar_msb_mask<char_type> & ~match;
+        if (mismatch != 0)
+        {
+            bump_swar(reader, swar_find_first<char_type>(mismatch));
+            break;
+        }
+
+        bump_swar(reader);
+    }
+}
+
+// A whitespace rule of the form `char_class | other | ...`, e.g. whitespace or comments.
+// Then we can skip the char class in SWAR blocks and only occasionally parse the others.
+template <typename WhitespaceRule>
+struct ws_choice
+{
+    template <typename Reader>
+    static constexpr bool is_fusable = false;
+};
+template <typename CharClass, typename... Others>
+struct ws_choice<lexyd::_chc<CharClass, Others...>>
+{
+    template <typename Reader>
+    static constexpr bool is_fusable = can_skip_ascii_swar<CharClass, Reader>;
+
+    using char_class = CharClass;
+    using others     = lexyd::_chc<Others...>;
+
+    // Whether one of the other alternatives could match at the reader.
+    template <typename Reader>
+    static constexpr bool can_start_other(const Reader& reader)
+    {
+        return (can_start<Others>(reader) || ...);
+    }
+
+    template <typename Rule, typename Reader>
+    static constexpr bool can_start(Reader reader)
+    {
+        if constexpr (lexy::is_token_rule<Rule>)
+            return lexy::try_match_token(Rule{}, reader);
+        else if constexpr (_is_token_branch<Rule>::value)
+            return can_start<typename _is_token_branch<Rule>::condition>(reader);
+        else
+            return true;
+    }
+
+    template <typename Rule>
+    struct _is_token_branch : std::false_type
+    {};
+    template <typename Condition, typename... R>
+    struct _is_token_branch<lexyd::_br<Condition, R...>>
+    : std::bool_constant<lexy::is_token_rule<Condition>>
+    {
+        using condition = Condition;
+    };
+};
+
 template <typename WhitespaceRule, typename Handler, typename Reader>
 constexpr auto skip_whitespace(ws_handler<Handler>&& handler, Reader& reader)
 {
@@ -117,15 +197,30 @@ constexpr auto skip_whitespace(ws_handler<Handler>&& handler, Reader& reader)
     {
         // Parsing a token repeatedly cannot fail, so we can optimize it.
 
-        if constexpr (_detail::is_swar_reader<Reader> //
-                      && space_is_definitely_whitespace<WhitespaceRule>())
+        if constexpr (can_skip_ascii_swar<WhitespaceRule, Reader>)
+        {
+            while (true)
+            {
+                // Skip as many ASCII whitespace characters as possible.
+                skip_ascii_swar<WhitespaceRule>(reader);
+
+                // We no longer have ASCII whitespace, skip the entire whitespace rule once,
+                // as it might match non-ASCII characters.
+                if (!lexy::try_match_token(WhitespaceRule{}, reader))
+                    // If that fails, we definitely have no more whitespace.
+                    break;
+            }
+        }
+        else if constexpr (_detail::has_swar<Reader> //
+                           && space_is_definitely_whitespace<WhitespaceRule>())
         {
             while (true)
             {
                 // Skip as many spaces as possible.
                 using char_type = typename Reader::encoding::char_type;
-                while (reader.peek_swar() == _detail::swar_fill(char_type(' ')))
-                    reader.bump_swar();
+                while (_detail::swar_available(reader)
+                       && _detail::peek_swar(reader) == _detail::swar_fill(char_type(' ')))
+                    _detail::bump_swar(reader);
 
                 // We no longer have a space, skip the entire whitespace rule once.
                 if (!lexy::try_match_token(WhitespaceRule{}, reader))
@@ -145,6 +240,35 @@ constexpr auto skip_whitespace(ws_handler<Handler>&& handler, Reader& reader)
                         reader.position());
         return std::true_type{};
     }
+    else if constexpr (ws_choice<WhitespaceRule>::template is_fusable<Reader>)
+    {
+        using char_class = typename ws_choice<WhitespaceRule>::char_class;
+        using production = ws_production<typename ws_choice<WhitespaceRule>::others>;
+
+        auto result = true;
+        while (true)
+        {
+            // Skip the char class as before.
+            skip_ascii_swar<char_class>(reader);
+            if (lexy::try_match_token(char_class{}, reader))
+                continue;
+
+            // Only parse the other alternatives if they could match.
+            if (!ws_choice<WhitespaceRule>::can_start_other(reader))
+                break;
+
+            auto other_begin = reader.position();
+            result = lexy::do_action<production, ws_result>(LEXY_MOV(handler),
+                                                            lexy::no_parse_state, reader);
+            if (!result || reader.position() == other_begin)
+                break;
+        }
+
+        handler.real_on(lexy::parse_events::token{},
+                        result ? lexy::whitespace_token_kind : lexy::error_token_kind, begin,
+                        reader.position());
+        return result;
+    }
     else if constexpr (!std::is_void_v<WhitespaceRule>)
     {
         using production = ws_production<WhitespaceRule>;
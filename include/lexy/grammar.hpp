@@ -186,6 +186,13 @@ LEXY_CONSTEVAL std::size_t max_recursion_depth()
         return 1024; // Arbitrary power of two.
 }
 
+template <typename Production>
+using _detect_whitespace = decltype(Production::whitespace);
+
+template <typename Production>
+constexpr auto _production_defines_whitespace
+    = lexy::_detail::is_detected<_detect_whitespace, Production>;
+
 template <typename T>
 using _enable_production_or_operation = std::enable_if_t<is_production<T> || is_operation<T>>;
 
@@ -195,12 +202,14 @@ struct production_info
     const char*        name;
     bool               is_token;
     bool               is_transparent;
+    bool               defines_whitespace;
 
     template <typename Production, typename = _enable_production_or_operation<Production>>
     constexpr production_info(Production)
     : id(_detail::type_id<Production>()), name(production_name<Production>()),
       is_token(is_token_production<Production>),
-      is_transparent(is_transparent_production<Production>)
+      is_transparent(is_transparent_production<Production>),
+      defines_whitespace(_production_defines_whitespace<Production>)
     {}
 
     friend constexpr bool operator==(production_info lhs, production_info rhs)
@@ -216,13 +225,6 @@ struct production_info
 
 namespace lexy
 {
-template <typename Production>
-using _detect_whitespace = decltype(Production::whitespace);
-
-template <typename Production>
-constexpr auto _production_defines_whitespace
-    = lexy::_detail::is_detected<_detect_whitespace, Production>;
-
 template <typename Production, typename WhitespaceProduction>
 auto _production_whitespace()
 {
@@ -281,6 +283,13 @@ struct _sfinae_sink
         _sink(LEXY_FWD(args)...);
     }
 
+    template <typename S = Sink>
+    LEXY_FORCE_INLINE constexpr auto reserve(std::size_t size)
+        -> decltype(LEXY_DECLVAL(S&).reserve(size))
+    {
+        return _sink.reserve(size);
+    }
+
     LEXY_FORCE_INLINE constexpr auto finish() &&
     {
         return LEXY_MOV(_sink).finish();
@@ -62,6 +62,20 @@ public:
         _cur = m._it;
     }
 
+    // Only constant time if _is_bulk, see lexy::_detail::is_bulk_reader.
+    static constexpr bool _is_bulk = std::is_same_v<Iterator, Sentinel>
+                                     && lexy::_detail::is_random_access_iterator<Iterator>;
+
+    constexpr std::size_t remaining() const noexcept
+    {
+        return lexy::_detail::range_size(_cur, _end);
+    }
+    constexpr void advance(std::size_t n) noexcept
+    {
+        LEXY_PRECONDITION(n <= remaining());
+        _cur = lexy::_detail::next(_cur, n);
+    }
+
 private:
     Iterator                   _cur;
     LEXY_EMPTY_MEMBER Sentinel _end;
@@ -75,6 +89,7 @@ LEXY_INSTANTIATION_NEWTYPE(_pr, _rr, Encoding, const typename Encoding::char_typ
 LEXY_INSTANTIATION_NEWTYPE(_prd, _pr, lexy::default_encoding);
 LEXY_INSTANTIATION_NEWTYPE(_pr8, _pr, lexy::utf8_encoding);
 LEXY_INSTANTIATION_NEWTYPE(_prc, _pr, lexy::utf8_char_encoding);
+LEXY_INSTANTIATION_NEWTYPE(_pr16, _pr, lexy::utf16_encoding);
 LEXY_INSTANTIATION_NEWTYPE(_prb, _pr, lexy::byte_encoding);
 
 template <typename Encoding, typename Iterator, typename Sentinel>
@@ -88,6 +103,8 @@ constexpr auto _range_reader(Iterator begin, Sentinel end)
             return _pr8(begin, end);
         else if constexpr (std::is_same_v<Encoding, lexy::utf8_char_encoding>)
             return _prc(begin, end);
+        else if constexpr (std::is_same_v<Encoding, lexy::utf16_encoding>)
+            return _pr16(begin, end);
         else if constexpr (std::is_same_v<Encoding, lexy::byte_encoding>)
             return _prb(begin, end);
         else
@@ -100,6 +117,22 @@ constexpr auto _range_reader(Iterator begin, Sentinel end)
 }
 } // namespace lexy
 
+namespace lexy::_detail
+{
+template <typename Reader>
+using _detect_bulk_reader = decltype(Reader::_is_bulk);
+
+// Whether reader.remaining() and reader.advance(n) are available in constant time.
+// This is the case for readers of pointers and other random access iterators.
+template <typename Reader>
+constexpr bool is_bulk_reader = [] {
+    if constexpr (is_detected<_detect_bulk_reader, Reader>)
+        return Reader::_is_bulk;
+    else
+        return false;
+}();
+} // namespace lexy::_detail
+
 namespace lexy
 {
 template <typename Input>
@@ -5,6 +5,7 @@
 #define LEXY_INPUT_BUFFER_HPP_INCLUDED
 
 #include <cstring>
+#include <lexy/_detail/code_point.hpp>
 #include <lexy/_detail/memory_resource.hpp>
 #include <lexy/_detail/swar.hpp>
 #include <lexy/error.hpp>
@@ -314,6 +315,29 @@ buffer(const View&, MemoryResource*)
     -> buffer<deduce_encoding<LEXY_DECAY_DECLTYPE(*LEXY_DECLVAL(View).data())>, MemoryResource>;
 
 //=== make_buffer ===//
+// Converts the group of bytes starting at memory to a code unit.
+template <typename CharT, encoding_endianness Endian>
+constexpr CharT _load_code_unit(const unsigned char* memory)
+{
+    constexpr auto is_char16 = std::is_same_v<CharT, char16_t>;
+    constexpr auto is_char32 = std::is_same_v<CharT, char32_t>;
+
+    if constexpr (sizeof(CharT) == 1)
+        return static_cast<CharT>(memory[0]);
+    else if constexpr (is_char16 && Endian == encoding_endianness::little)
+        return static_cast<CharT>((memory[0] << 0) | (memory[1] << 8));
+    else if constexpr (is_char32 && Endian == encoding_endianness::little)
+        return static_cast<CharT>((memory[0] << 0) | (memory[1] << 8) | (memory[2] << 16)
+                                  | (memory[3] << 24));
+    else if constexpr (is_char16 && Endian == encoding_endianness::big)
+        return static_cast<CharT>((memory[0] << 8) | (memory[1] << 0));
+    else if constexpr (is_char32 && Endian == encoding_endianness::big)
+        return static_cast<CharT>((memory[0] << 24) | (memory[1] << 16) | (memory[2] << 8)
+                                  | (memory[3] << 0));
+    else
+        static_assert(_detail::error<CharT>, "unhandled encoding/endianness");
+}
+
 template <typename Encoding, encoding_endianness Endian>
 struct _make_buffer
 {
@@ -343,24 +367,7 @@ struct _make_buffer
 
             const auto end = memory + size;
             for (auto dest = builder.data(); memory != end; memory += sizeof(char_type))
-            {
-                constexpr auto is_char16 = std::is_same_v<char_type, char16_t>;
-                constexpr auto is_char32 = std::is_same_v<char_type, char32_t>;
-
-                // We convert each group of bytes to the appropriate value.
-                if constexpr (is_char16 && Endian == encoding_endianness::little)
-                    *dest++ = static_cast<char_type>((memory[0] << 0) | (memory[1] << 8));
-                else if constexpr (is_char32 && Endian == encoding_endianness::little)
-                    *dest++ = static_cast<char_type>((memory[0] << 0) | (memory[1] << 8)
-                                                     | (memory[2] << 16) | (memory[3] << 24));
-                else if constexpr (is_char16 && Endian == encoding_endianness::big)
-                    *dest++ = static_cast<char_type>((memory[0] << 8) | (memory[1] << 0));
-                else if constexpr (is_char32 && Endian == encoding_endianness::big)
-                    *dest++ = static_cast<char_type>((memory[0] << 24) | (memory[1] << 16)
-                                                     | (memory[2] << 8) | (memory[3] << 0));
-                else
-                    static_assert(_detail::error<Encoding>, "unhandled encoding/endianness");
-            }
+                *dest++ = _load_code_unit<char_type, Endian>(memory);
 
             return LEXY_MOV(builder).finish();
         }
@@ -452,6 +459,363 @@ struct _make_buffer<utf32_encoding, encoding_endianness::bom>
 template <typename Encoding, encoding_endianness Endianness>
 constexpr auto make_buffer_from_raw = _make_buffer<Encoding, Endianness>{};
 
+//=== make_buffer_transcoded ===//
+template <typename Encoding = default_encoding, typename MemoryResource = void>
+class transcode_result
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+
+    explicit operator bool() const noexcept
+    {
+        return _error_count == 0;
+    }
+
+    const lexy::buffer<Encoding, MemoryResource>& buffer() const& noexcept
+    {
+        return _buffer;
+    }
+    lexy::buffer<Encoding, MemoryResource>&& buffer() && noexcept
+    {
+        return LEXY_MOV(_buffer);
+    }
+
+    std::size_t error_count() const noexcept
+    {
+        return _error_count;
+    }
+
+    std::size_t first_error() const noexcept
+    {
+        LEXY_PRECONDITION(!*this);
+        return _first_error;
+    }
+
+public:
+    // Pretend this doesn't exist.
+    explicit transcode_result(lexy::buffer<Encoding, MemoryResource>&& buffer,
+                              std::size_t error_count, std::size_t first_error) noexcept
+    : _buffer(LEXY_MOV(buffer)), _error_count(error_count), _first_error(first_error)
+    {}
+
+private:
+    lexy::buffer<Encoding, MemoryResource> _buffer;
+    std::size_t                            _error_count;
+    std::size_t                            _first_error;
+};
+
+// Reads code units of the specified endianness from raw memory.
+template <typename Encoding, encoding_endianness Endian>
+class _transcode_reader
+{
+public:
+    using encoding = Encoding;
+    using iterator = const unsigned char*;
+
+    struct marker
+    {
+        iterator _it;
+
+        constexpr iterator position() const noexcept
+        {
+            return _it;
+        }
+    };
+
+    explicit _transcode_reader(iterator begin, iterator end) noexcept : _cur(begin), _end(end) {}
+
+    auto peek() const noexcept
+    {
+        if (_cur == _end)
+            return encoding::eof();
+        else
+            return encoding::to_int_type(
+                _load_code_unit<typename encoding::char_type, Endian>(_cur));
+    }
+
+    void bump() noexcept
+    {
+        _cur += sizeof(typename encoding::char_type);
+    }
+
+    iterator position() const noexcept
+    {
+        return _cur;
+    }
+
+    marker current() const noexcept
+    {
+        return {_cur};
+    }
+    void reset(marker m) noexcept
+    {
+        _cur = m._it;
+    }
+
+private:
+    iterator _cur;
+    iterator _end;
+};
+
+template <typename From, encoding_endianness Endian, typename To>
+class _transcoder
+{
+    using from_char_type = typename From::char_type;
+    using to_char_type   = typename To::char_type;
+
+    static constexpr auto _replacement_character = char32_t(0xFFFD);
+
+    // A code unit with all but the ASCII bits set, in the byte order of the memory.
+    static constexpr from_char_type _non_ascii_bits()
+    {
+        constexpr auto native_endianness
+            = LEXY_IS_LITTLE_ENDIAN ? encoding_endianness::little : encoding_endianness::big;
+
+        auto bits = static_cast<from_char_type>(~0x7Fu);
+        if constexpr (sizeof(from_char_type) > 1 && Endian != native_endianness)
+        {
+            auto swapped = from_char_type(0);
+            for (auto i = 0u; i != sizeof(from_char_type); ++i)
+            {
+                swapped = from_char_type(swapped << CHAR_BIT) | from_char_type(bits & 0xFF);
+                bits    = from_char_type(bits >> CHAR_BIT);
+            }
+            bits = swapped;
+        }
+        return bits;
+    }
+
+public:
+    explicit _transcoder(const unsigned char* base, const unsigned char* begin,
+                         const unsigned char* end) noexcept
+    : _base(base), _begin(begin), _end(end - std::size_t(end - begin) % sizeof(from_char_type)),
+      _has_partial(_end != end)
+    {}
+
+    template <typename Sink>
+    void run(Sink& sink) const
+    {
+        auto cur = _begin;
+        while (cur != _end)
+        {
+            // We check for a block of ASCII characters using SWAR first.
+            // Every ASCII character is a single code unit in every encoding, so it can be copied
+            // without any decoding.
+            if (std::size_t(_end - cur) >= sizeof(_detail::swar_int))
+            {
+                constexpr auto non_ascii = _detail::swar_fill(_non_ascii_bits());
+
+                _detail::swar_int block;
+                std::memcpy(&block, cur, sizeof(block));
+                if ((block & non_ascii) == 0)
+                {
+                    sink.ascii(cur, _detail::swar_length<from_char_type>);
+                    cur += sizeof(block);
+                    continue;
+                }
+            }
+
+            sink.code_point(_decode(cur, sink));
+        }
+
+        if (_has_partial)
+        {
+            // The memory ends with an incomplete code unit.
+            sink.error(std::size_t(_end - _base));
+            sink.code_point(_replacement_character);
+        }
+    }
+
+private:
+    template <typename Sink>
+    char32_t _decode(const unsigned char*& cur, Sink& sink) const
+    {
+        if constexpr (std::is_same_v<From, byte_encoding>)
+        {
+            // We interpret bytes as Latin-1, where each byte is the code point of the same value.
+            return char32_t(*cur++);
+        }
+        else
+        {
+            _transcode_reader<From, Endian> reader(cur, _end);
+
+            auto result = _detail::parse_code_point(reader);
+            if (result.error == _detail::cp_error::success)
+            {
+                cur = result.end.position();
+                return result.cp;
+            }
+
+            sink.error(std::size_t(cur - _base));
+            if (result.error == _detail::cp_error::eof)
+                // We're not at the end, so it's a code unit that looks like EOF; consume it.
+                reader.bump();
+            else
+                _detail::recover_code_point(reader, result);
+
+            cur = reader.position();
+            return _replacement_character;
+        }
+    }
+
+    const unsigned char* _base;
+    const unsigned char* _begin;
+    const unsigned char* _end;
+    bool                 _has_partial;
+};
+
+template <typename To, typename Callback>
+struct _transcode_counter
+{
+    std::size_t size        = 0;
+    std::size_t error_count = 0;
+    std::size_t first_error = 0;
+    Callback&   callback;
+
+    void ascii(const unsigned char*, std::size_t length)
+    {
+        size += length;
+    }
+
+    void code_point(char32_t cp)
+    {
+        typename To::char_type buffer[4] = {};
+        size += _detail::encode_code_point<To>(cp, buffer, 4);
+    }
+
+    void error(std::size_t offset)
+    {
+        if (error_count == 0)
+            first_error = offset;
+        ++error_count;
+        callback(offset);
+    }
+};
+
+template <typename From, encoding_endianness Endian, typename To>
+struct _transcode_writer
+{
+    typename To::char_type* dest;
+    typename To::char_type* end;
+
+    void ascii(const unsigned char* block, std::size_t length)
+    {
+        using from_char_type = typename From::char_type;
+        using to_char_type   = typename To::char_type;
+
+        if constexpr (sizeof(from_char_type) == 1 && sizeof(to_char_type) == 1)
+        {
+            std::memcpy(dest, block, length);
+            dest += length;
+        }
+        else
+        {
+            for (auto i = 0u; i != length; ++i)
+                *dest++ = static_cast<to_char_type>(
+                    _load_code_unit<from_char_type, Endian>(block + i * sizeof(from_char_type)));
+        }
+    }
+
+    void code_point(char32_t cp)
+    {
+        dest += _detail::encode_code_point<To>(cp, dest, std::size_t(end - dest));
+    }
+
+    void error(std::size_t) {}
+};
+
+template <typename From, typename To, encoding_endianness Endian>
+struct _make_buffer_transcoded
+{
+    static_assert(std::is_same_v<To, utf8_encoding> || std::is_same_v<To, utf8_char_encoding>
+                      || std::is_same_v<To, utf16_encoding> || std::is_same_v<To, utf32_encoding>,
+                  "can only transcode to a Unicode encoding");
+
+    template <encoding_endianness MemoryEndian, typename Callback, typename MemoryResource>
+    static auto _transcode(const unsigned char* base, const unsigned char* begin,
+                           const unsigned char* end, Callback& on_error, MemoryResource* resource)
+    {
+        _transcoder<From, MemoryEndian, To> transcoder(base, begin, end);
+
+        // We first determine the size of the result, then transcode directly into the buffer.
+        _transcode_counter<To, Callback> counter{0, 0, 0, on_error};
+        transcoder.run(counter);
+
+        typename buffer<To, MemoryResource>::builder builder(counter.size, resource);
+        _transcode_writer<From, MemoryEndian, To>    writer{builder.data(),
+                                                         builder.data() + builder.size()};
+        transcoder.run(writer);
+        LEXY_ASSERT(writer.dest == writer.end, "size computation went wrong");
+
+        return transcode_result<To, MemoryResource>(LEXY_MOV(builder).finish(),
+                                                    counter.error_count, counter.first_error);
+    }
+
+    template <typename MemoryResource = void>
+    auto operator()(const void* memory, std::size_t size,
+                    MemoryResource* resource = _detail::get_memory_resource<MemoryResource>()) const
+    {
+        return (*this)(memory, size, [](std::size_t) {}, resource);
+    }
+
+    template <typename Callback, typename MemoryResource = void,
+              typename = decltype(LEXY_DECLVAL(Callback&)(std::size_t(0)))>
+    auto operator()(const void* _memory, std::size_t size, Callback on_error,
+                    MemoryResource* resource = _detail::get_memory_resource<MemoryResource>()) const
+    {
+        constexpr auto big    = encoding_endianness::big;
+        constexpr auto little = encoding_endianness::little;
+
+        auto memory = static_cast<const unsigned char*>(_memory);
+        auto end    = memory + size;
+
+        if constexpr (Endian != encoding_endianness::bom
+                      || sizeof(typename From::char_type) == 1)
+        {
+            // We skip over a UTF-8 BOM, it doesn't matter.
+            if constexpr (Endian == encoding_endianness::bom
+                          && (std::is_same_v<From, utf8_encoding>
+                              || std::is_same_v<From, utf8_char_encoding>))
+            {
+                if (size >= 3 && memory[0] == 0xEF && memory[1] == 0xBB && memory[2] == 0xBF)
+                    return _transcode<big>(memory, memory + 3, end, on_error, resource);
+            }
+
+            constexpr auto endian = Endian == encoding_endianness::bom ? big : Endian;
+            return _transcode<endian>(memory, memory, end, on_error, resource);
+        }
+        else if constexpr (std::is_same_v<From, utf16_encoding>)
+        {
+            if (size >= 2 && memory[0] == 0xFF && memory[1] == 0xFE)
+                return _transcode<little>(memory, memory + 2, end, on_error, resource);
+            else if (size >= 2 && memory[0] == 0xFE && memory[1] == 0xFF)
+                return _transcode<big>(memory, memory + 2, end, on_error, resource);
+            else
+                return _transcode<big>(memory, memory, end, on_error, resource);
+        }
+        else if constexpr (std::is_same_v<From, utf32_encoding>)
+        {
+            if (size >= 4 && memory[0] == 0xFF && memory[1] == 0xFE && memory[2] == 0x00
+                && memory[3] == 0x00)
+                return _transcode<little>(memory, memory + 4, end, on_error, resource);
+            else if (size >= 4 && memory[0] == 0x00 && memory[1] == 0x00 && memory[2] == 0xFE
+                     && memory[3] == 0xFF)
+                return _transcode<big>(memory, memory + 4, end, on_error, resource);
+            else
+                return _transcode<big>(memory, memory, end, on_error, resource);
+        }
+        else
+        {
+            static_assert(_detail::error<From>, "unhandled encoding/endianness");
+        }
+    }
+};
+
+/// Creates a buffer by transcoding raw memory in one encoding to another one.
+template <typename From, typename To, encoding_endianness Endianness = encoding_endianness::bom>
+constexpr auto make_buffer_transcoded = _make_buffer_transcoded<From, To, Endianness>{};
+
 //=== make_buffer_from_input ===//
 template <typename Input>
 using _detect_input_data = decltype(LEXY_DECLVAL(Input&).data());
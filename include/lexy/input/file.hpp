@@ -132,6 +132,197 @@ auto read_stdin(MemoryResource* resource = _detail::get_memory_resource<MemoryRe
     auto error = _detail::read_stdin(user_data.callback(), &user_data);
     return read_file_result(error, LEXY_MOV(user_data.buffer));
 }
+
+//=== read_file_auto ===//
+/// The encoding of a file, as detected by lexy::read_file_auto().
+enum class file_encoding
+{
+    utf8,
+    utf16_little,
+    utf16_big,
+    utf32_little,
+    utf32_big,
+};
+
+template <typename Encoding = utf8_encoding, typename MemoryResource = void>
+class read_file_auto_result
+{
+public:
+    using encoding  = Encoding;
+    using char_type = typename encoding::char_type;
+
+    explicit operator bool() const noexcept
+    {
+        return _ec == file_error::_success;
+    }
+
+    const lexy::buffer<Encoding, MemoryResource>& buffer() const& noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _buffer;
+    }
+    lexy::buffer<Encoding, MemoryResource>&& buffer() && noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return LEXY_MOV(_buffer);
+    }
+
+    file_error error() const noexcept
+    {
+        LEXY_PRECONDITION(!*this);
+        return _ec;
+    }
+
+    file_encoding source_encoding() const noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _source;
+    }
+
+    std::size_t transcode_error_count() const noexcept
+    {
+        LEXY_PRECONDITION(*this);
+        return _error_count;
+    }
+    std::size_t first_transcode_error() const noexcept
+    {
+        LEXY_PRECONDITION(*this && _error_count > 0);
+        return _first_error;
+    }
+
+public:
+    // Pretend this doesn't exist.
+    explicit read_file_auto_result(file_error ec, lexy::buffer<Encoding, MemoryResource>&& buffer,
+                                   file_encoding source, std::size_t error_count,
+                                   std::size_t first_error) noexcept
+    : _buffer(LEXY_MOV(buffer)), _ec(ec), _source(source), _error_count(error_count),
+      _first_error(first_error)
+    {}
+
+private:
+    lexy::buffer<Encoding, MemoryResource> _buffer;
+    file_error                             _ec;
+    file_encoding                          _source;
+    std::size_t                            _error_count;
+    std::size_t                            _first_error;
+};
+
+// Detects the encoding from the BOM.
+// Without a BOM, it assumes the file starts with an ASCII character and looks for zero bytes.
+constexpr file_encoding _detect_file_encoding(const unsigned char* memory, std::size_t size,
+                                              std::size_t& bom_size)
+{
+    bom_size = 0;
+
+    // Note that the UTF-32 little endian BOM starts with the UTF-16 little endian one.
+    if (size >= 4 && memory[0] == 0xFF && memory[1] == 0xFE && memory[2] == 0x00
+        && memory[3] == 0x00)
+    {
+        bom_size = 4;
+        return file_encoding::utf32_little;
+    }
+    else if (size >= 4 && memory[0] == 0x00 && memory[1] == 0x00 && memory[2] == 0xFE
+             && memory[3] == 0xFF)
+    {
+        bom_size = 4;
+        return file_encoding::utf32_big;
+    }
+    else if (size >= 3 && memory[0] == 0xEF && memory[1] == 0xBB && memory[2] == 0xBF)
+    {
+        bom_size = 3;
+        return file_encoding::utf8;
+    }
+    else if (size >= 2 && memory[0] == 0xFF && memory[1] == 0xFE)
+    {
+        bom_size = 2;
+        return file_encoding::utf16_little;
+    }
+    else if (size >= 2 && memory[0] == 0xFE && memory[1] == 0xFF)
+    {
+        bom_size = 2;
+        return file_encoding::utf16_big;
+    }
+
+    if (size >= 4 && size % 4 == 0 && memory[0] == 0x00 && memory[1] == 0x00
+        && memory[2] == 0x00 && memory[3] != 0x00)
+        return file_encoding::utf32_big;
+    else if (size >= 4 && size % 4 == 0 && memory[0] != 0x00 && memory[1] == 0x00
+             && memory[2] == 0x00 && memory[3] == 0x00)
+        return file_encoding::utf32_little;
+    else if (size >= 2 && size % 2 == 0 && memory[0] == 0x00 && memory[1] != 0x00)
+        return file_encoding::utf16_big;
+    else if (size >= 2 && size % 2 == 0 && memory[0] != 0x00 && memory[1] == 0x00)
+        return file_encoding::utf16_little;
+    else
+        return file_encoding::utf8;
+}
+
+template <typename Encoding, typename MemoryResource>
+struct _read_file_auto_user_data
+{
+    lexy::buffer<Encoding, MemoryResource> buffer;
+    MemoryResource*                        resource;
+    file_encoding                          source      = file_encoding::utf8;
+    std::size_t                            error_count = 0;
+    std::size_t                            first_error = 0;
+
+    _read_file_auto_user_data(MemoryResource* resource) : buffer(resource), resource(resource) {}
+
+    template <typename From, encoding_endianness Endian>
+    void transcode(const unsigned char* memory, std::size_t size, std::size_t bom_size)
+    {
+        auto result = lexy::make_buffer_transcoded<From, Encoding, Endian>(memory + bom_size,
+                                                                           size - bom_size,
+                                                                           resource);
+        error_count = result.error_count();
+        if (error_count > 0)
+            first_error = bom_size + result.first_error();
+        buffer = LEXY_MOV(result).buffer();
+    }
+
+    static auto callback()
+    {
+        return [](void* _user_data, const char* _memory, std::size_t size) {
+            constexpr auto little    = encoding_endianness::little;
+            constexpr auto big       = encoding_endianness::big;
+            auto           user_data = static_cast<_read_file_auto_user_data*>(_user_data);
+            auto           memory    = reinterpret_cast<const unsigned char*>(_memory);
+
+            auto bom_size     = std::size_t(0);
+            user_data->source = _detect_file_encoding(memory, size, bom_size);
+            switch (user_data->source)
+            {
+            case file_encoding::utf8:
+                user_data->template transcode<utf8_encoding, big>(memory, size, bom_size);
+                break;
+            case file_encoding::utf16_little:
+                user_data->template transcode<utf16_encoding, little>(memory, size, bom_size);
+                break;
+            case file_encoding::utf16_big:
+                user_data->template transcode<utf16_encoding, big>(memory, size, bom_size);
+                break;
+            case file_encoding::utf32_little:
+                user_data->template transcode<utf32_encoding, little>(memory, size, bom_size);
+                break;
+            case file_encoding::utf32_big:
+                user_data->template transcode<utf32_encoding, big>(memory, size, bom_size);
+                break;
+            }
+        };
+    }
+};
+
+/// Reads the file at the specified path into a buffer, detecting its encoding and transcoding it.
+template <typename Encoding = utf8_encoding, typename MemoryResource = void>
+auto read_file_auto(const char*     path,
+                    MemoryResource* resource = _detail::get_memory_resource<MemoryResource>())
+    -> read_file_auto_result<Encoding, MemoryResource>
+{
+    _read_file_auto_user_data<Encoding, MemoryResource> user_data(resource);
+    auto error = _detail::read_file(path, user_data.callback(), &user_data);
+    return read_file_auto_result(error, LEXY_MOV(user_data.buffer), user_data.source,
+                                 user_data.error_count, user_data.first_error);
+}
 } // namespace lexy
 
 #endif // LEXY_INPUT_FILE_HPP_INCLUDED
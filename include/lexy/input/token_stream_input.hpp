@@ -0,0 +1,171 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_INPUT_TOKEN_STREAM_INPUT_HPP_INCLUDED
+#define LEXY_INPUT_TOKEN_STREAM_INPUT_HPP_INCLUDED
+
+#include <lexy/error.hpp>
+#include <lexy/input/base.hpp>
+#include <lexy/lexeme.hpp>
+#include <lexy/token.hpp>
+
+#if !LEXY_EXPERIMENTAL
+#    error "lexy::token_stream_input is experimental"
+#endif
+
+namespace lexy
+{
+template <typename Token>
+class token_stream_encoding
+{
+public:
+    using char_encoding = typename LEXY_DECAY_DECLTYPE(LEXY_DECLVAL(Token).lexeme())::encoding;
+    using char_type     = typename char_encoding::char_type;
+    using value_type    = const Token*;
+
+    // We use a null pointer to indicate the end of the token stream.
+    static LEXY_CONSTEVAL auto eof()
+    {
+        return nullptr;
+    }
+
+    template <typename TokenKind>
+    static constexpr bool match(const Token* token, const TokenKind& kind)
+    {
+        return token != nullptr && token->kind() == kind;
+    }
+};
+template <typename Token>
+constexpr auto is_node_encoding<token_stream_encoding<Token>> = true;
+
+template <typename Reader, typename TokenKind>
+auto _token_reader(const lexy::token<Reader, TokenKind>*) -> Reader;
+
+template <typename Token>
+class _tsr // token stream reader
+{
+public:
+    using encoding = token_stream_encoding<Token>;
+    using iterator = typename LEXY_DECAY_DECLTYPE(LEXY_DECLVAL(Token).lexeme())::iterator;
+
+    // A parse tree of the tokens stores the same lexemes as the one of the original input.
+    using parse_tree_reader = decltype(_token_reader(LEXY_DECLVAL(const Token*)));
+
+    struct marker
+    {
+        const Token* _cur;
+        const Token* _end;
+        iterator     _end_pos;
+
+        constexpr iterator position() const noexcept
+        {
+            return _cur == _end ? _end_pos : _cur->lexeme().begin();
+        }
+    };
+
+    constexpr explicit _tsr(const Token* begin, const Token* end, iterator end_pos) noexcept
+    : _cur(begin), _end(end), _end_pos(end_pos)
+    {}
+
+    constexpr auto lexeme_reader() const& noexcept
+    {
+        LEXY_PRECONDITION(_cur != _end);
+        auto lexeme = _cur->lexeme();
+        return _range_reader<typename encoding::char_encoding>(lexeme.begin(), lexeme.end());
+    }
+
+    constexpr const Token* peek() const noexcept
+    {
+        return _cur == _end ? nullptr : _cur;
+    }
+
+    constexpr void bump() noexcept
+    {
+        LEXY_PRECONDITION(_cur != _end);
+        ++_cur;
+    }
+
+    constexpr marker current() const noexcept
+    {
+        return {_cur, _end, _end_pos};
+    }
+    constexpr void reset(marker m) noexcept
+    {
+        _cur = m._cur;
+    }
+
+    constexpr iterator position() const noexcept
+    {
+        return current().position();
+    }
+
+private:
+    const Token* _cur;
+    const Token* _end;
+    iterator     _end_pos;
+};
+
+template <typename Token>
+class token_stream_input
+{
+public:
+    using encoding   = token_stream_encoding<Token>;
+    using value_type = Token;
+    using iterator   = typename _tsr<Token>::iterator;
+
+    //=== constructors ===//
+    constexpr token_stream_input() noexcept : _data(nullptr), _size(0u), _end_pos() {}
+
+    constexpr token_stream_input(const Token* data, std::size_t size) noexcept
+    : _data(data), _size(size), _end_pos(size == 0 ? iterator() : data[size - 1].lexeme().end())
+    {}
+    constexpr token_stream_input(const Token* data, std::size_t size, iterator end_pos) noexcept
+    : _data(data), _size(size), _end_pos(end_pos)
+    {}
+
+    template <typename Container,
+              typename = std::enable_if_t<std::is_same_v<
+                  const Token*, decltype(static_cast<const Token*>(LEXY_DECLVAL(Container).data()))>>>
+    constexpr explicit token_stream_input(const Container& container) noexcept
+    : token_stream_input(container.data(), container.size())
+    {}
+
+    //=== access ===//
+    constexpr const Token* data() const noexcept
+    {
+        return _data;
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    //=== reader ===//
+    constexpr auto reader() const& noexcept
+    {
+        return _tsr<Token>(_data, _data + _size, _end_pos);
+    }
+
+private:
+    const Token* _data;
+    std::size_t  _size;
+    iterator     _end_pos;
+};
+
+template <typename Container>
+token_stream_input(const Container& container)
+    -> token_stream_input<LEXY_DECAY_DECLTYPE(*LEXY_DECLVAL(Container).data())>;
+
+//=== convenience typedefs ===//
+template <typename Token>
+using token_stream_lexeme = lexeme_for<token_stream_input<Token>>;
+
+template <typename Tag, typename Token>
+using token_stream_error = error_for<token_stream_input<Token>, Tag>;
+
+template <typename Token>
+using token_stream_error_context = error_context<token_stream_input<Token>>;
+} // namespace lexy
+
+#endif // LEXY_INPUT_TOKEN_STREAM_INPUT_HPP_INCLUDED
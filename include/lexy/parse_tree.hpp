@@ -6,6 +6,7 @@
 
 #include <lexy/_detail/assert.hpp>
 #include <lexy/_detail/config.hpp>
+#include <lexy/_detail/detect.hpp>
 #include <lexy/_detail/iterator.hpp>
 #include <lexy/_detail/memory_resource.hpp>
 #include <lexy/grammar.hpp>
@@ -145,19 +146,27 @@ struct pt_node_token : pt_node<Reader>
 template <typename Reader>
 struct pt_node_production : pt_node<Reader>
 {
-    static constexpr std::size_t child_count_bits = sizeof(std::size_t) * CHAR_BIT - 2;
+    static constexpr std::size_t child_count_bits = sizeof(std::size_t) * CHAR_BIT - 3;
 
     const char* const* id;
     std::size_t        child_count : child_count_bits;
     std::size_t        token_production : 1;
+    std::size_t        whitespace_production : 1;
     std::size_t        first_child_adjacent : 1;
 
     explicit pt_node_production(production_info info) noexcept
     : pt_node<Reader>(pt_node<Reader>::type_production), id(info.id), child_count(0),
-      token_production(info.is_token), first_child_adjacent(true)
+      token_production(info.is_token), whitespace_production(info.defines_whitespace),
+      first_child_adjacent(true)
     {
         LEXY_PRECONDITION(!info.is_transparent);
     }
+    explicit pt_node_production(const char* const* id, bool is_token,
+                                bool defines_whitespace) noexcept
+    : pt_node<Reader>(pt_node<Reader>::type_production), id(id), child_count(0),
+      token_production(is_token), whitespace_production(defines_whitespace),
+      first_child_adjacent(true)
+    {}
 
     pt_node<Reader>* first_child()
     {
@@ -412,8 +421,15 @@ private:
     std::size_t                          _depth;
 };
 
+// Readers of inputs that are not character based can specify the reader of the characters instead.
+template <typename Reader>
+using _detect_parse_tree_reader = typename Reader::parse_tree_reader;
+template <typename Reader>
+using _parse_tree_reader = _detail::detected_or<Reader, _detect_parse_tree_reader, Reader>;
+
 template <typename Input, typename TokenKind = void, typename MemoryResource = void>
-using parse_tree_for = lexy::parse_tree<lexy::input_reader<Input>, TokenKind, MemoryResource>;
+using parse_tree_for
+    = lexy::parse_tree<_parse_tree_reader<lexy::input_reader<Input>>, TokenKind, MemoryResource>;
 
 template <typename Reader, typename TokenKind, typename MemoryResource>
 class parse_tree<Reader, TokenKind, MemoryResource>::builder
@@ -586,20 +602,15 @@ public:
             // Don't need to add a new node for a transparent production.
             return _cur;
 
-        // Allocate a node for the production and append it to the current child list.
-        // We reserve enough memory to allow for a trailing pointer.
-        // This is only necessary if the first child is in a new block,
-        // in which case we won't overwrite it.
-        _result._buffer.reserve(sizeof(_detail::pt_node_production<Reader>)
-                                + sizeof(_detail::pt_node<Reader>*));
-        auto node
-            = _result._buffer.template allocate<_detail::pt_node_production<Reader>>(production);
-        // Note: don't append the node yet, we might still backtrack.
-
-        // Subsequent insertions are to the new node, so update marker and return old one.
-        auto old = LEXY_MOV(_cur);
-        _cur     = marker(node, old.cur_depth + 1, node);
-        return old;
+        return _start_production_node(production);
+    }
+    // Starts a production node for the same production as the (production) node of `kind`.
+    auto start_production(node_kind kind)
+    {
+        auto prod = kind._ptr->as_production();
+        LEXY_PRECONDITION(prod);
+        return _start_production_node(prod->id, bool(prod->token_production),
+                                      bool(prod->whitespace_production));
     }
 
     void finish_production(marker&& m)
@@ -747,6 +758,24 @@ public:
     }
 
 private:
+    template <typename... Args>
+    marker _start_production_node(const Args&... args)
+    {
+        // Allocate a node for the production and append it to the current child list.
+        // We reserve enough memory to allow for a trailing pointer.
+        // This is only necessary if the first child is in a new block,
+        // in which case we won't overwrite it.
+        _result._buffer.reserve(sizeof(_detail::pt_node_production<Reader>)
+                                + sizeof(_detail::pt_node<Reader>*));
+        auto node = _result._buffer.template allocate<_detail::pt_node_production<Reader>>(args...);
+        // Note: don't append the node yet, we might still backtrack.
+
+        // Subsequent insertions are to the new node, so update marker and return old one.
+        auto old = LEXY_MOV(_cur);
+        _cur     = marker(node, old.cur_depth + 1, node);
+        return old;
+    }
+
     parse_tree _result;
     marker     _cur;
 };
@@ -775,6 +804,10 @@ public:
     {
         return is_production() && _ptr->as_production()->token_production;
     }
+    bool defines_whitespace() const noexcept
+    {
+        return is_production() && _ptr->as_production()->whitespace_production;
+    }
 
     const char* name() const noexcept
     {
@@ -844,6 +877,8 @@ private:
     _detail::pt_node<Reader>* _ptr;
 
     friend _pt_node<Reader, TokenKind>;
+    template <typename, typename, typename>
+    friend class parse_tree;
 };
 
 template <typename Reader, typename TokenKind>
@@ -0,0 +1,68 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_EXT_INTERN_TABLE_HPP_INCLUDED
+#define LEXY_EXT_INTERN_TABLE_HPP_INCLUDED
+
+#include <climits>
+#include <lexy/callback/intern.hpp>
+#include <mutex>
+
+namespace lexy_ext
+{
+/// An intern table that can be used by multiple threads concurrently.
+///
+/// The strings are distributed over `ShardCount` independent `lexy::intern_table`s,
+/// each protected by its own mutex, so threads only contend if they intern a string of the same
+/// shard at the same time.
+template <typename CharT, std::size_t ShardCount = 16>
+class sharded_intern_table
+{
+    using table = lexy::intern_table<CharT>;
+
+public:
+    using char_type = CharT;
+    using handle    = typename table::handle;
+
+    sharded_intern_table() = default;
+
+    sharded_intern_table(const sharded_intern_table&)            = delete;
+    sharded_intern_table& operator=(const sharded_intern_table&) = delete;
+
+    /// The total number of strings in the table.
+    std::size_t size() const
+    {
+        auto result = std::size_t(0);
+        for (auto& shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            result += shard.strings.size();
+        }
+        return result;
+    }
+
+    handle intern(const CharT* str, std::size_t size)
+    {
+        auto hash = table::hash(str, size);
+
+        // The low bits of the hash are used by the table itself, so we select the shard using the
+        // high bits.
+        auto& shard = _shards[(hash >> (sizeof(std::size_t) * CHAR_BIT / 2)) % ShardCount];
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.strings.intern(str, size, hash);
+    }
+
+private:
+    // Each shard gets its own cache line, so locking one doesn't slow down the others.
+    struct alignas(64) shard
+    {
+        mutable std::mutex mutex;
+        table              strings;
+    };
+
+    shard _shards[ShardCount];
+};
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_INTERN_TABLE_HPP_INCLUDED
@@ -0,0 +1,186 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef LEXY_EXT_PARALLEL_VISIT_HPP_INCLUDED
+#define LEXY_EXT_PARALLEL_VISIT_HPP_INCLUDED
+
+#include <atomic>
+#include <exception>
+#include <lexy/parse_tree.hpp>
+#include <thread>
+#include <vector>
+
+namespace lexy_ext
+{
+/// Runs all tasks one after the other on the calling thread.
+struct sequential_executor
+{
+    template <typename Task>
+    void operator()(std::size_t task_count, Task&& task) const
+    {
+        for (auto idx = std::size_t(0); idx != task_count; ++idx)
+            task(idx);
+    }
+};
+
+/// Runs the tasks concurrently on the calling thread and `thread_count - 1` additional threads.
+class thread_executor
+{
+public:
+    thread_executor() : thread_executor(std::thread::hardware_concurrency()) {}
+    explicit thread_executor(unsigned thread_count)
+    : _thread_count(thread_count > 0 ? thread_count : 1)
+    {}
+
+    unsigned thread_count() const noexcept
+    {
+        return _thread_count;
+    }
+
+    template <typename Task>
+    void operator()(std::size_t task_count, Task&& task) const
+    {
+        // Each thread repeatedly grabs the next task until all are done,
+        // so a few large tasks don't leave the other threads idle.
+        // If a task throws, we remember the first exception and don't start any new tasks.
+        std::atomic<std::size_t> next(0);
+        std::atomic<bool>        failed(false);
+        std::exception_ptr       exception;
+        auto                     worker = [&] {
+            try
+            {
+                for (auto idx = next.fetch_add(1, std::memory_order_relaxed); idx < task_count;
+                     idx      = next.fetch_add(1, std::memory_order_relaxed))
+                    task(idx);
+            }
+            catch (...)
+            {
+                next.store(task_count, std::memory_order_relaxed);
+                if (!failed.exchange(true))
+                    exception = std::current_exception();
+            }
+        };
+
+        auto extra_threads = _thread_count - 1 < task_count ? _thread_count - 1 : task_count;
+        {
+            // Joins the threads even if creating one of them throws.
+            _thread_list threads;
+            threads.reserve(extra_threads);
+            for (auto i = std::size_t(0); i != extra_threads; ++i)
+                threads.emplace_back(worker);
+
+            worker();
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+private:
+    struct _thread_list : std::vector<std::thread>
+    {
+        _thread_list() = default;
+
+        _thread_list(const _thread_list&)            = delete;
+        _thread_list& operator=(const _thread_list&) = delete;
+
+        ~_thread_list()
+        {
+            for (auto& thread : *this)
+                thread.join();
+        }
+    };
+
+    unsigned _thread_count;
+};
+} // namespace lexy_ext
+
+namespace lexy_ext
+{
+template <typename TokenKind, typename Predicate>
+auto _node_predicate(Predicate predicate)
+{
+    if constexpr (std::is_constructible_v<lexy::token_kind<TokenKind>, Predicate>)
+        return [kind = lexy::token_kind<TokenKind>(predicate)](auto n) { return n.kind() == kind; };
+    else if constexpr (lexy::is_production<Predicate>)
+        return [](auto n) { return n.kind() == Predicate{}; };
+    else
+        return predicate;
+}
+
+template <typename Node, typename Predicate>
+void _collect_partitions(Node root, Predicate& predicate, std::vector<Node>& result)
+{
+    if (predicate(root))
+    {
+        result.push_back(root);
+        return;
+    }
+
+    // We keep an explicit stack of the remaining children on each level,
+    // so deeply nested trees can't overflow the call stack.
+    using children_range = decltype(root.children());
+    using iterator       = typename children_range::iterator;
+    std::vector<std::pair<iterator, iterator>> stack;
+
+    auto children = root.children();
+    stack.emplace_back(children.begin(), children.end());
+    while (!stack.empty())
+    {
+        auto& top = stack.back();
+        if (top.first == top.second)
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        auto node = *top.first;
+        ++top.first;
+        if (predicate(node))
+        {
+            // The partition contains the entire subtree, so we don't need to look further.
+            result.push_back(node);
+        }
+        else
+        {
+            auto node_children = node.children();
+            stack.emplace_back(node_children.begin(), node_children.end());
+        }
+    }
+}
+
+/// Partitions the tree at the outermost nodes that match the predicate,
+/// and invokes `fn` with each of those nodes using the executor.
+///
+/// The parse tree is not modified during visitation, so `fn` can be called concurrently.
+/// If predicate is a token kind or production, it matches nodes of that kind;
+/// otherwise, it is a function object that is invoked with the node.
+/// Returns the number of partitions.
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Predicate,
+          typename Fn, typename Executor>
+std::size_t parallel_visit(const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree,
+                           Predicate predicate, Fn fn, Executor&& executor)
+{
+    using node_t = typename lexy::parse_tree<Reader, TokenKind, MemoryResource>::node;
+    if (tree.empty())
+        return 0;
+
+    // Partitioning is cheap compared to the visitation, so we do it up-front.
+    auto                pred = _node_predicate<TokenKind>(LEXY_MOV(predicate));
+    std::vector<node_t> partitions;
+    _collect_partitions(tree.root(), pred, partitions);
+
+    executor(partitions.size(), [&](std::size_t idx) { fn(partitions[idx]); });
+    return partitions.size();
+}
+
+template <typename Reader, typename TokenKind, typename MemoryResource, typename Predicate,
+          typename Fn>
+std::size_t parallel_visit(const lexy::parse_tree<Reader, TokenKind, MemoryResource>& tree,
+                           Predicate predicate, Fn fn)
+{
+    return parallel_visit(tree, LEXY_MOV(predicate), LEXY_MOV(fn), thread_executor());
+}
+} // namespace lexy_ext
+
+#endif // LEXY_EXT_PARALLEL_VISIT_HPP_INCLUDED
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+# SPDX-License-Identifier: BSL-1.0
+
+# Generates the table of 128-bit approximations of powers of five used by `dsl::real`.
+# For each q, the entry is 5^q normalized such that the most significant bit is set, truncated
+# (for q >= 0) or rounded up (for q < 0) to 128 bits.
+
+import sys
+
+smallest_power_of_five = -342
+largest_power_of_five  = 308
+
+def power_of_five_128(q):
+    if q >= 0:
+        power = 5 ** q
+        while power < 2 ** 127:
+            power *= 2
+        while power >= 2 ** 128:
+            power //= 2
+        return power
+    else:
+        power = 5 ** -q
+        z = 0
+        while (1 << z) < power:
+            z += 1
+        if q >= -27:
+            b = z + 127
+            c = 2 ** b // power + 1
+        else:
+            b = 2 * z + 2 * 64
+            c = 2 ** b // power + 1
+            while c >= 2 ** 128:
+                c //= 2
+        return c
+
+def generate_table():
+    yield '// AUTOGENERATED FILE --- DO NOT EDIT!\n'
+    yield '// Generated by `support/generate-float-table.py`.\n'
+    yield '\n'
+    yield 'namespace lexy::_detail\n'
+    yield '{\n'
+    yield f'constexpr int power_of_five_min = {smallest_power_of_five};\n'
+    yield f'constexpr int power_of_five_max = {largest_power_of_five};\n'
+    yield '\n'
+    yield '// Two entries per power of five, most significant word first.\n'
+    yield 'constexpr std::uint64_t power_of_five_128[] = {\n'
+    for q in range(smallest_power_of_five, largest_power_of_five + 1):
+        value = power_of_five_128(q)
+        yield f'    0x{value >> 64:016x}, 0x{value & (2 ** 64 - 1):016x}, // 5^{q}\n'
+    yield '};\n'
+    yield '} // namespace lexy::_detail\n'
+
+if len(sys.argv) != 2:
+    print(f"usage: {sys.argv[0]} <output>")
+    sys.exit(1)
+
+with open(sys.argv[1], "w") as output_file:
+    print(''.join(generate_table()), end='', file=output_file)
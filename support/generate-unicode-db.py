@@ -102,7 +102,10 @@ def unicode_database():
 
 #=== Lookup tables ===#
 class LookupTables:
-    BLOCK_SIZE = 256
+    # With 128 code points per block, the index of a block still fits into a byte, and a block
+    # occupies exactly two cache lines.
+    BLOCK_SIZE = 128
+    BLOCK_ALIGNMENT = 64
 
     def __init__(self):
         self.block_starts = [] # Stage 1
@@ -145,7 +148,91 @@ def build_lookup_tables(database):
 
     return result
 
-def estimate_table_size(tables):
+#=== UTF-8 automatons ===#
+# The binary properties that can be matched directly on UTF-8 code units, without decoding a code point.
+UTF8_DFA_PROPERTIES = ['alphabetic', 'xid_start', 'xid_continue']
+
+class Utf8Automatons:
+    # States below FINAL_STATE expect at least two more continuation bytes.
+    # Each has a row of 64 transitions, indexed by the lower six bits of the next continuation byte.
+    # Row 0 is the start state, which is indexed by the lower six bits of the lead byte instead.
+    #
+    # States starting at FINAL_STATE expect exactly one more continuation byte.
+    # They store the index of a 64 bit mask that has bit n set if the continuation byte 0x80 + n is accepted.
+    # Mask 0 is empty and used for invalid sequences.
+    FINAL_STATE = 0x8000
+
+    def __init__(self):
+        self.masks       = [0]
+        self.transitions = {} # property name -> transition table
+
+def build_utf8_automatons(database):
+    result = Utf8Automatons()
+    mask_dict = {0: 0}
+
+    def final_state(mask):
+        index = mask_dict.get(mask)
+        if index is None:
+            index = len(result.masks)
+            result.masks.append(mask)
+            mask_dict[mask] = index
+        return Utf8Automatons.FINAL_STATE + index
+
+    reject = final_state(0)
+
+    for prop in UTF8_DFA_PROPERTIES:
+        attr = f'is_{prop}'
+        rows = [None] # placeholder for the start state
+        row_dict = {}
+
+        # The state after reading the lead byte and some continuation bytes,
+        # value contains the bits of the code point so far.
+        def state(value, remaining, lower, upper):
+            if remaining == 1:
+                mask = 0
+                for n in range(64):
+                    cp = (value << 6) | n
+                    if lower <= cp <= upper and not 0xD800 <= cp <= 0xDFFF and getattr(database[cp], attr):
+                        mask |= 1 << n
+                return final_state(mask)
+
+            # Skip prefixes that can't lead to a valid code point.
+            shift = 6 * remaining
+            if (value + 1) << shift <= lower or value << shift > upper:
+                return reject
+
+            row = tuple(state((value << 6) | n, remaining - 1, lower, upper) for n in range(64))
+            if all(next == reject for next in row):
+                return reject
+
+            index = row_dict.get(row)
+            if index is None:
+                index = len(rows)
+                rows.append(row)
+                row_dict[row] = index
+            return index
+
+        start = []
+        for lead in range(0xC0, 0x100):
+            if lead < 0xC2:
+                start.append(reject) # overlong
+            elif lead < 0xE0:
+                start.append(state(lead & 0x1F, 1, 0x80, 0x7FF))
+            elif lead < 0xF0:
+                start.append(state(lead & 0x0F, 2, 0x800, 0xFFFF))
+            elif lead < 0xF5:
+                start.append(state(lead & 0x07, 3, 0x10000, 0x10FFFF))
+            else:
+                start.append(reject)
+        rows[0] = tuple(start)
+
+        assert len(rows) < Utf8Automatons.FINAL_STATE
+        result.transitions[prop] = [next for row in rows for next in row]
+
+    assert len(result.masks) <= 2**16 - Utf8Automatons.FINAL_STATE
+    return result
+
+def estimate_table_size(tables, automatons):
     # one byte each
     block_starts = len(tables.block_starts)
     blocks = len(tables.blocks)
@@ -159,9 +246,13 @@ def estimate_table_size(tables):
     # case folding is four bytes each
     case_folding = len(tables.properties) * 4
 
-    return block_starts + blocks + category + binary_properties + case_folding
+    # masks are eight bytes, transitions two bytes each
+    utf8_automatons = len(automatons.masks) * 8 \
+                      + sum(len(transitions) for transitions in automatons.transitions.values()) * 2
 
-def generate_lookup_tables(tables):
+    return block_starts + blocks + category + binary_properties + case_folding + utf8_automatons
+
+def generate_lookup_tables(tables, automatons):
     def int_array(ints):
         yield '"'
         for idx, value in enumerate(ints):
@@ -173,18 +264,20 @@ def generate_lookup_tables(tables):
                 yield r'\"'
             elif char == '\\':
                 yield r'\\'
-            elif char.isprintable():
+            elif char.isascii() and char.isprintable():
                 yield char
             else:
                 yield f'\\{value:03o}'
         yield '"'
 
     def lookup_function():
+        shift = LookupTables.BLOCK_SIZE.bit_length() - 1
+
         yield 'constexpr std::size_t property_index(char32_t code_point)\n'
         yield '{\n'
         yield '    LEXY_PRECONDITION(code_point <= 0x10FFFF);\n'
-        yield '    auto high = (code_point >> 8) & 0xFFFF;\n'
-        yield '    auto low  = code_point & 0xFF;\n'
+        yield f'    auto high = code_point >> {shift};\n'
+        yield f'    auto low  = code_point & 0x{LookupTables.BLOCK_SIZE - 1:X};\n'
         yield '\n'
         yield '    auto block_start = static_cast<unsigned char>(block_starts[high]);\n'
         yield f'    auto block_index = block_start * {LookupTables.BLOCK_SIZE}u + low;\n'
@@ -238,6 +331,18 @@ def generate_lookup_tables(tables):
             yield f'{prop.case_folding},'
         yield '}'
 
+    def utf8_mask_array(masks):
+        yield '{'
+        for mask in masks:
+            yield f'0x{mask:X}u,'
+        yield '}'
+
+    def utf8_transition_array(transitions):
+        yield '{'
+        for next in transitions:
+            yield f'{next},'
+        yield '}'
+
     assert max(tables.block_starts) < 2**8
     assert max(tables.blocks) < 2**8
 
@@ -254,7 +359,7 @@ def generate_lookup_tables(tables):
     yield from int_array(tables.block_starts)
     yield ';\n'
 
-    yield 'constexpr const char* blocks = '
+    yield f'alignas({LookupTables.BLOCK_ALIGNMENT}) constexpr char blocks[] = '
     yield from int_array(tables.blocks)
     yield ';\n'
 
@@ -280,6 +385,22 @@ def generate_lookup_tables(tables):
     yield from case_fold_array(tables.properties)
     yield ';\n'
 
+    yield '\n'
+    yield f'constexpr std::uint_least16_t utf8_dfa_final = 0x{Utf8Automatons.FINAL_STATE:X};\n'
+    yield 'constexpr std::uint_least64_t utf8_dfa_masks[] = '
+    yield from utf8_mask_array(automatons.masks)
+    yield ';\n'
+    for prop, transitions in automatons.transitions.items():
+        yield f'constexpr std::uint_least16_t utf8_dfa_{prop}[] = '
+        yield from utf8_transition_array(transitions)
+        yield ';\n'
+    yield '\n'
+    yield 'template <binary_properties_t Prop>\n'
+    yield 'constexpr const std::uint_least16_t* utf8_dfa = nullptr;\n'
+    for prop in automatons.transitions:
+        yield 'template <>\n'
+        yield f'constexpr const std::uint_least16_t* utf8_dfa<{prop}> = utf8_dfa_{prop};\n'
+
     yield '} // namespace lexy::_unicode_db'
 
 #=== main ===#
@@ -293,12 +414,14 @@ output_path = sys.argv[1]
 
 database = unicode_database()
 tables = build_lookup_tables(database)
+automatons = build_utf8_automatons(database)
 
 print(f"block_starts length: {len(tables.block_starts)}")
 print(f"blocks length: {len(tables.blocks)}")
 print(f"properties length: {len(tables.properties)}")
-print(f"total size estimate: {estimate_table_size(tables)} bytes")
+print(f"UTF-8 automaton masks length: {len(automatons.masks)}")
+print(f"total size estimate: {estimate_table_size(tables, automatons)} bytes")
 
 with open(output_path, "w") as output_file:
-    print(''.join(generate_lookup_tables(tables)), file=output_file)
+    print(''.join(generate_lookup_tables(tables, automatons)), file=output_file)
 
@@ -239,3 +239,109 @@ TEST_CASE("parse_as_tree")
     }
 }
 
+
+TEST_CASE("parse_as_tree filter")
+{
+    using parse_tree = lexy::parse_tree_for<lexy::string_input<>, token_kind>;
+    parse_tree tree;
+
+    auto input = lexy::zstring_input("123 ( abc //  \n) 321!!!");
+
+    SUBCASE("keep_all_nodes")
+    {
+        auto result = lexy::parse_as_tree<root_p, lexy::keep_all_nodes>(tree, input, lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .whitespace(" ")
+            .production(child_p{})
+                .token(token_kind::b, "(")
+                .whitespace(" ")
+                .production("abc_p")
+                    .token(token_kind::c, "abc")
+                    .finish()
+                .whitespace(" //  \\{a}")
+                .token(token_kind::b, ")")
+                .whitespace(" ")
+                .finish()
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+        CHECK(tree.remaining_input().begin() == input.data() + 20);
+    }
+    SUBCASE("drop_whitespace_nodes")
+    {
+        auto result
+            = lexy::parse_as_tree<root_p, lexy::drop_whitespace_nodes>(tree, input, lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .production(child_p{})
+                .token(token_kind::b, "(")
+                .production("abc_p")
+                    .token(token_kind::c, "abc")
+                    .finish()
+                .token(token_kind::b, ")")
+                .finish()
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+        CHECK(tree.size() == 8);
+        CHECK(tree.remaining_input().begin() == input.data() + 20);
+        CHECK(tree.remaining_input().end() == input.data() + 23);
+
+        for (auto [event, node] : tree.traverse())
+            if (event == lexy::traverse_event::enter && node.kind() == child_p{})
+                CHECK(node.position() == input.data() + 4);
+    }
+    SUBCASE("drop_token_nodes")
+    {
+        auto result = lexy::parse_as_tree<root_p, lexy::drop_token_nodes<token_kind::b>>(tree, input,
+                                                                                       lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .whitespace(" ")
+            .production(child_p{})
+                .token(lexy::position_token_kind, "")
+                .whitespace(" ")
+                .production("abc_p")
+                    .token(token_kind::c, "abc")
+                    .finish()
+                .whitespace(" //  \\{a}")
+                .whitespace(" ")
+                .finish()
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+
+        for (auto [event, node] : tree.traverse())
+            if (event == lexy::traverse_event::enter && node.kind() == child_p{})
+                CHECK(node.position() == input.data() + 4);
+    }
+    SUBCASE("drop_production_nodes")
+    {
+        using filter = lexy::combine_node_filters<lexy::drop_whitespace_nodes,
+                                                  lexy::drop_production_nodes<child_p>>;
+        auto result  = lexy::parse_as_tree<root_p, filter>(tree, input, lexy::noop);
+        CHECK(result);
+
+        // clang-format off
+        auto expected = lexy_ext::parse_tree_desc<token_kind>(root_p{})
+            .token(token_kind::a, "123")
+            .token(token_kind::b, "(")
+            .production("abc_p")
+                .token(token_kind::c, "abc")
+                .finish()
+            .token(token_kind::b, ")")
+            .token(token_kind::a, "321");
+        // clang-format on
+        CHECK(tree == expected);
+    }
+}
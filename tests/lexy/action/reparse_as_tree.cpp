@@ -0,0 +1,204 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/action/reparse_as_tree.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/dsl.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy_ext/parse_tree_doctest.hpp>
+
+namespace
+{
+struct state
+{
+    int declarations = 0;
+};
+
+struct value_p
+{
+    static constexpr auto name = "value_p";
+    static constexpr auto rule = lexy::dsl::digits<>;
+};
+
+struct decl_p
+{
+    static constexpr auto name = "decl_p";
+    static constexpr auto rule
+        = lexy::dsl::effect<[](state& s) { ++s.declarations; }> //
+          + lexy::dsl::identifier(lexy::dsl::ascii::alpha) + lexy::dsl::equal_sign
+          + lexy::dsl::p<value_p> + lexy::dsl::semicolon;
+};
+
+struct root_p
+{
+    static constexpr auto name       = "root_p";
+    static constexpr auto whitespace = lexy::dsl::ascii::space;
+    static constexpr auto rule
+        = lexy::dsl::terminator(lexy::dsl::eof).opt_list(lexy::dsl::p<decl_p>);
+};
+
+struct opt_root_p
+{
+    static constexpr auto name = "opt_root_p";
+    static constexpr auto rule
+        = lexy::dsl::opt(lexy::dsl::list(lexy::dsl::peek(lexy::dsl::ascii::alpha)
+                                         >> lexy::dsl::p<decl_p>));
+};
+
+struct val_p
+{
+    static constexpr auto name = "val_p";
+    static constexpr auto rule
+        = lexy::dsl::lit_c<'('> + lexy::dsl::digits<> + lexy::dsl::lit_c<')'>;
+};
+
+struct line_p : lexy::token_production
+{
+    static constexpr auto name = "line_p";
+    static constexpr auto rule = LEXY_LIT("x") + lexy::dsl::p<val_p> + lexy::dsl::semicolon;
+};
+
+struct line_root_p
+{
+    static constexpr auto name       = "line_root_p";
+    static constexpr auto whitespace = lexy::dsl::ascii::space;
+    static constexpr auto rule
+        = lexy::dsl::terminator(lexy::dsl::eof).opt_list(lexy::dsl::p<line_p>);
+};
+
+using parse_tree = lexy::parse_tree_for<lexy::string_input<>>;
+
+template <typename Input>
+parse_tree parse(const Input& input)
+{
+    parse_tree tree;
+    state      s;
+    auto       result = lexy::parse_as_tree<root_p>(tree, input, s, lexy::noop);
+    REQUIRE(result);
+    return tree;
+}
+} // namespace
+
+TEST_CASE("reparse_as_tree")
+{
+    auto old_input = lexy::zstring_input("a = 1;  b = 22; c = 3;");
+    auto old_tree  = parse(old_input);
+
+    parse_tree tree;
+    state      s;
+
+    SUBCASE("edit inside restartable production")
+    {
+        // Replace `22` by `456`.
+        auto input  = lexy::zstring_input("a = 1;  b = 456; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p>(tree, old_tree, input, s, {12, 2, 3},
+                                                            lexy::noop);
+        CHECK(result);
+        CHECK(s.declarations == 1);
+
+        auto expected = parse(input);
+        CHECK(doctest::toString(tree) == doctest::toString(expected));
+        CHECK(tree.size() == expected.size());
+        CHECK(tree.depth() == expected.depth());
+        CHECK(tree.root().position() == input.data());
+        CHECK(tree.remaining_input().begin() == input.data() + 23);
+    }
+    SUBCASE("edit inside nested restartable production")
+    {
+        // Insert `45` into `22`.
+        auto input  = lexy::zstring_input("a = 1;  b = 2452; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p, value_p>(tree, old_tree, input, s,
+                                                                     {13, 0, 2}, lexy::noop);
+        CHECK(result);
+        CHECK(s.declarations == 0);
+        CHECK(doctest::toString(tree) == doctest::toString(parse(input)));
+    }
+    SUBCASE("edit changes structure")
+    {
+        // Insert `; d = 4`, which creates a new declaration.
+        auto input  = lexy::zstring_input("a = 1;  b = 2; d = 42; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p>(tree, old_tree, input, s, {13, 0, 7},
+                                                            lexy::noop);
+        CHECK(result);
+        // The effect of the restart that didn't fit is discarded.
+        CHECK(s.declarations == 4);
+        CHECK(doctest::toString(tree) == doctest::toString(parse(input)));
+    }
+    SUBCASE("edit spans multiple productions")
+    {
+        auto input  = lexy::zstring_input("a = 11; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p>(tree, old_tree, input, s, {5, 10, 2},
+                                                            lexy::noop);
+        CHECK(result);
+        CHECK(s.declarations == 2);
+        CHECK(doctest::toString(tree) == doctest::toString(parse(input)));
+    }
+    SUBCASE("edit introduces error")
+    {
+        auto input  = lexy::zstring_input("a = 1;  b = 2x; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p>(tree, old_tree, input, s, {13, 1, 1},
+                                                            lexy::noop);
+        CHECK(!result);
+        CHECK(result.error_count() == 1);
+        CHECK(s.declarations == 2);
+    }
+    SUBCASE("old tree with errors")
+    {
+        auto error_input = lexy::zstring_input("a = 1;  b = 2x; c = 3;");
+        auto error_tree  = parse_tree();
+        auto error_result = lexy::parse_as_tree<root_p>(error_tree, error_input, s, lexy::noop);
+        REQUIRE(error_result.error_count() == 1);
+        s.declarations = 0;
+
+        // Replace `1` by `4`; the error in `b` has to be reported again.
+        auto input  = lexy::zstring_input("a = 4;  b = 2x; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p, decl_p>(tree, error_tree, input, s,
+                                                            {4, 1, 1}, lexy::noop);
+        CHECK(!result);
+        CHECK(result.error_count() == 1);
+        CHECK(s.declarations == 2);
+    }
+    SUBCASE("old tree without children")
+    {
+        auto empty_input = lexy::zstring_input("");
+        auto empty_tree  = parse_tree();
+        REQUIRE(lexy::parse_as_tree<opt_root_p>(empty_tree, empty_input, s, lexy::noop));
+        REQUIRE(empty_tree.root().children().empty());
+
+        auto input  = lexy::zstring_input("a=1;");
+        auto result = lexy::reparse_as_tree<opt_root_p, decl_p>(tree, empty_tree, input, s,
+                                                                {0, 0, 4}, lexy::noop);
+        CHECK(result);
+        CHECK(s.declarations == 1);
+        CHECK(tree.root().children().empty() == false);
+    }
+    SUBCASE("no restartable production")
+    {
+        auto input  = lexy::zstring_input("a = 1;  b = 456; c = 3;");
+        auto result = lexy::reparse_as_tree<root_p>(tree, old_tree, input, s, {12, 2, 3},
+                                                    lexy::noop);
+        CHECK(result);
+        CHECK(s.declarations == 3);
+        CHECK(doctest::toString(tree) == doctest::toString(parse(input)));
+    }
+
+    SUBCASE("restart below token production")
+    {
+        auto line_input = lexy::zstring_input("x(1); x(2);");
+        auto line_tree  = parse_tree();
+        REQUIRE(lexy::parse_as_tree<line_root_p>(line_tree, line_input, lexy::noop));
+
+        // Insert a space, which isn't allowed inside the token production.
+        auto input = lexy::zstring_input("x( 1); x(2);");
+
+        auto expected        = parse_tree();
+        auto expected_result = lexy::parse_as_tree<line_root_p>(expected, input, lexy::noop);
+        REQUIRE(expected_result.error_count() == 1);
+
+        auto result = lexy::reparse_as_tree<line_root_p, val_p>(tree, line_tree, input, {2, 0, 1},
+                                                                lexy::noop);
+        CHECK(result.error_count() == expected_result.error_count());
+        CHECK(doctest::toString(tree) == doctest::toString(expected));
+    }
+}
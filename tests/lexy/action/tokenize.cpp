@@ -0,0 +1,134 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/action/tokenize.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/action/parse_as_tree.hpp>
+#include <lexy/dsl.hpp>
+#include <lexy/input/string_input.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+enum class token_kind
+{
+    number,
+    name,
+};
+
+struct list_p
+{
+    static constexpr auto whitespace = lexy::dsl::ascii::space;
+
+    static constexpr auto rule = [] {
+        auto number = lexy::dsl::digits<>.kind<token_kind::number>;
+        auto name   = lexy::dsl::token(lexy::dsl::while_one(lexy::dsl::ascii::alpha)).kind<token_kind::name>;
+        auto item   = number | lexy::dsl::else_ >> name;
+        return lexy::dsl::square_bracketed.opt_list(item, lexy::dsl::sep(lexy::dsl::comma));
+    }();
+};
+
+using token = lexy::token_for<lexy::string_input<>, token_kind>;
+
+struct collector
+{
+    std::vector<token>*       tokens;
+    std::vector<std::size_t>* batches;
+
+    void operator()(const token* data, std::size_t size)
+    {
+        batches->push_back(size);
+        tokens->insert(tokens->end(), data, data + size);
+    }
+};
+
+std::string to_string(const token& t)
+{
+    auto lexeme = t.lexeme();
+    return std::string(t.name()) + ":" + std::string(lexeme.begin(), lexeme.end());
+}
+} // namespace
+
+TEST_CASE("tokenize")
+{
+    std::vector<token>       tokens;
+    std::vector<std::size_t> batches;
+
+    auto tokenize = [&](const char* str) {
+        tokens.clear();
+        batches.clear();
+        return lexy::tokenize<list_p, token_kind>(lexy::zstring_input(str),
+                                                  collector{&tokens, &batches});
+    };
+
+    SUBCASE("empty")
+    {
+        auto result = tokenize("[]");
+        CHECK(result);
+        REQUIRE(tokens.size() == 2);
+        CHECK(to_string(tokens[0]) == "literal:[");
+        CHECK(to_string(tokens[1]) == "literal:]");
+        CHECK(batches == std::vector<std::size_t>{2});
+    }
+    SUBCASE("items")
+    {
+        auto result = tokenize("[1, abc ,23]");
+        CHECK(result);
+        REQUIRE(tokens.size() == 9);
+        CHECK(tokens[0].kind() == lexy::literal_token_kind);
+        CHECK(tokens[1].kind() == token_kind::number);
+        CHECK(tokens[2].kind() == lexy::literal_token_kind);
+        CHECK(to_string(tokens[3]) == "whitespace: ");
+        CHECK(tokens[4].kind() == token_kind::name);
+        CHECK(to_string(tokens[4]) == "token:abc");
+        CHECK(tokens[5].kind() == lexy::whitespace_token_kind);
+        CHECK(tokens[6].kind() == lexy::literal_token_kind);
+        CHECK(tokens[7].kind() == token_kind::number);
+        CHECK(tokens[8].kind() == lexy::literal_token_kind);
+    }
+    SUBCASE("error")
+    {
+        auto result = tokenize("[1, 2");
+        CHECK(!result);
+        REQUIRE(tokens.size() == 5);
+        CHECK(tokens[4].kind() == token_kind::number);
+    }
+    SUBCASE("batches")
+    {
+        std::string str = "[1";
+        for (auto i = 0; i != 1000; ++i)
+            str += ",1";
+        str += "]";
+
+        auto result = tokenize(str.c_str());
+        CHECK(result);
+        CHECK(tokens.size() == 2 + 2 * 1001 - 1);
+        CHECK(batches.size() == 8);
+        for (auto i = 0u; i != batches.size() - 1; ++i)
+            CHECK(batches[i] == 256);
+    }
+    SUBCASE("same as parse_as_tree")
+    {
+        auto input  = lexy::zstring_input("[ 1 , abc,2 , def ]");
+        auto result = lexy::tokenize<list_p, token_kind>(input, collector{&tokens, &batches});
+        CHECK(result);
+
+        lexy::parse_tree_for<decltype(input), token_kind> tree;
+        REQUIRE(lexy::parse_as_tree<list_p>(tree, input, lexy::noop));
+
+        std::vector<token> tree_tokens;
+        for (auto [event, node] : tree.traverse())
+            if (event == lexy::traverse_event::leaf)
+                tree_tokens.push_back(node.token());
+
+        REQUIRE(tokens.size() == tree_tokens.size());
+        for (auto i = 0u; i != tokens.size(); ++i)
+        {
+            CHECK(tokens[i].kind() == tree_tokens[i].kind());
+            CHECK(tokens[i].lexeme().begin() == tree_tokens[i].lexeme().begin());
+            CHECK(tokens[i].lexeme().end() == tree_tokens[i].lexeme().end());
+        }
+    }
+}
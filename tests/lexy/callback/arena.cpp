@@ -0,0 +1,161 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/callback/arena.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/action/parse.hpp>
+#include <lexy/callback/container.hpp>
+#include <lexy/dsl/integer.hpp>
+#include <lexy/dsl/punctuator.hpp>
+#include <lexy/dsl/repeat.hpp>
+#include <lexy/dsl/separator.hpp>
+#include <lexy/input/string_input.hpp>
+#include <vector>
+
+namespace
+{
+struct counting_resource
+{
+    int allocations   = 0;
+    int deallocations = 0;
+
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        ++allocations;
+        return lexy::_detail::default_memory_resource::allocate(bytes, alignment);
+    }
+    void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept
+    {
+        ++deallocations;
+        lexy::_detail::default_memory_resource::deallocate(ptr, bytes, alignment);
+    }
+
+    friend bool operator==(const counting_resource& lhs, const counting_resource& rhs)
+    {
+        return &lhs == &rhs;
+    }
+};
+
+template <typename T>
+using arena_vector = std::vector<T, lexy::arena_allocator<T>>;
+
+struct parse_state
+{
+    lexy::arena<> arena;
+};
+
+struct integer_list
+{
+    static constexpr auto rule = [] {
+        namespace dsl = lexy::dsl;
+        auto item     = dsl::integer<int>;
+        return dsl::repeat(item + dsl::colon).list(item, dsl::sep(dsl::comma));
+    }();
+    static constexpr auto value
+        = lexy::as_list<arena_vector<int>>.allocator(&parse_state::arena);
+};
+} // namespace
+
+TEST_CASE("arena")
+{
+    counting_resource resource;
+
+    SUBCASE("basic")
+    {
+        lexy::arena<counting_resource> arena(&resource);
+        CHECK(resource.allocations == 0);
+
+        auto a = arena.allocate(3, 1);
+        auto b = arena.allocate(8, 8);
+        CHECK(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+        CHECK(static_cast<unsigned char*>(b) - static_cast<unsigned char*>(a) >= 3);
+        CHECK(resource.allocations == 1);
+
+        auto c = arena.allocate(64, 64);
+        CHECK(reinterpret_cast<std::uintptr_t>(c) % 64 == 0);
+        arena.deallocate(c, 64, 64);
+        CHECK(resource.deallocations == 0);
+
+        // Bigger than the first block.
+        arena.allocate(10000, 8);
+        CHECK(resource.allocations == 2);
+
+        arena.release();
+        CHECK(resource.deallocations == 2);
+
+        arena.allocate(3, 1);
+        CHECK(resource.allocations == 3);
+    }
+    SUBCASE("block growth")
+    {
+        lexy::arena<counting_resource> arena(&resource);
+
+        // 1MiB in small allocations needs only a logarithmic number of blocks.
+        for (auto i = 0; i != 64 * 1024; ++i)
+            arena.allocate(16, 8);
+        CHECK(resource.allocations <= 10);
+    }
+    SUBCASE("dedicated block")
+    {
+        lexy::arena<counting_resource> arena(&resource);
+
+        auto a = static_cast<unsigned char*>(arena.allocate(8, 8));
+        CHECK(resource.allocations == 1);
+
+        arena.allocate(10000, 8);
+        CHECK(resource.allocations == 2);
+
+        // We continue in the first block.
+        auto b = static_cast<unsigned char*>(arena.allocate(8, 8));
+        CHECK(b == a + 8);
+        CHECK(resource.allocations == 2);
+    }
+    SUBCASE("destructor")
+    {
+        {
+            lexy::arena<counting_resource> arena(&resource);
+            for (auto i = 0; i != 1024; ++i)
+                arena.allocate(16, 8);
+            CHECK(resource.allocations > 1);
+        }
+        CHECK(resource.deallocations == resource.allocations);
+    }
+    SUBCASE("default resource")
+    {
+        lexy::arena<> arena;
+        auto          ptr = static_cast<int*>(arena.allocate(sizeof(int), alignof(int)));
+        *ptr              = 42;
+        CHECK(*ptr == 42);
+    }
+}
+
+TEST_CASE("arena_allocator")
+{
+    lexy::arena<> arena;
+
+    arena_vector<int> vec(arena);
+    vec.push_back(1);
+    vec.push_back(2);
+    vec.push_back(3);
+    CHECK(vec == arena_vector<int>({1, 2, 3}, arena));
+
+    lexy::arena_allocator<long> other(vec.get_allocator());
+    CHECK(&other.get_arena() == &arena);
+    CHECK(vec.get_allocator() == lexy::arena_allocator<int>(arena));
+
+    lexy::arena<> other_arena;
+    CHECK(vec.get_allocator() != lexy::arena_allocator<int>(other_arena));
+}
+
+TEST_CASE("as_list with arena")
+{
+    parse_state state;
+
+    auto result = lexy::parse<integer_list>(lexy::zstring_input("3:1,2,3"), state, lexy::noop);
+    REQUIRE(result);
+    CHECK(result.value() == arena_vector<int>({1, 2, 3}, state.arena));
+    CHECK(&result.value().get_allocator().get_arena() == &state.arena);
+    // dsl::repeat knows the number of items, so the vector was reserved exactly.
+    CHECK(result.value().capacity() == 3);
+}
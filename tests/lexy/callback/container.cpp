@@ -74,6 +74,17 @@ TEST_CASE("as_list")
         std::vector<std::string> result = LEXY_MOV(cb).finish();
         CHECK(result == std::vector<std::string>{"a", "b", "c"});
     }
+    SUBCASE("sink reserve")
+    {
+        constexpr auto sink = lexy::as_list<std::vector<std::string>>;
+        auto           cb   = sink.sink();
+        cb.reserve(3);
+        cb("a");
+
+        std::vector<std::string> result = LEXY_MOV(cb).finish();
+        CHECK(result == std::vector<std::string>{"a"});
+        CHECK(result.capacity() >= 3);
+    }
     SUBCASE("sink allocator")
     {
         constexpr auto sink = lexy::as_list<std::vector<std::string, my_allocator<std::string>>>;
@@ -0,0 +1,123 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/callback/intern.hpp>
+
+#include <cstring>
+#include <doctest/doctest.h>
+#include <lexy/action/parse.hpp>
+#include <lexy/callback/container.hpp>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/identifier.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/production.hpp>
+#include <lexy/dsl/punctuator.hpp>
+#include <lexy/dsl/separator.hpp>
+#include <lexy/input/string_input.hpp>
+#include <string>
+#include <vector>
+
+TEST_CASE("intern_table")
+{
+    lexy::intern_table<char> table;
+    CHECK(table.size() == 0);
+
+    auto abc = table.intern("abc", 3);
+    CHECK(abc);
+    CHECK(abc.size() == 3);
+    CHECK(std::strcmp(abc.c_str(), "abc") == 0);
+    CHECK(table.size() == 1);
+
+    std::string copy = "abc";
+    CHECK(table.intern(copy.data(), copy.size()) == abc);
+    CHECK(table.intern(copy.data(), copy.size()).data() == abc.data());
+    CHECK(table.size() == 1);
+
+    auto ab = table.intern("abc", 2);
+    CHECK(ab != abc);
+    CHECK(std::strcmp(ab.c_str(), "ab") == 0);
+
+    auto empty = table.intern("", 0);
+    CHECK(empty);
+    CHECK(empty.size() == 0);
+    CHECK(empty != ab);
+    CHECK(table.intern("", 0) == empty);
+    CHECK(table.size() == 3);
+
+    // Enough strings to rehash multiple times.
+    std::vector<lexy::interned_string<char>> handles;
+    for (auto i = 0; i != 1000; ++i)
+    {
+        auto str = std::to_string(i);
+        handles.push_back(table.intern(str.data(), str.size()));
+    }
+    CHECK(table.size() == 1003);
+    for (auto i = 0; i != 1000; ++i)
+    {
+        auto str = std::to_string(i);
+        CHECK(table.intern(str.data(), str.size()) == handles[std::size_t(i)]);
+        CHECK(handles[std::size_t(i)].c_str() == str);
+    }
+    CHECK(table.intern("abc", 3) == abc);
+    CHECK(table.size() == 1003);
+
+    CHECK(!lexy::interned_string<char>());
+}
+
+namespace
+{
+struct parse_state
+{
+    lexy::intern_table<char> identifiers;
+};
+
+struct identifier
+{
+    static constexpr auto rule = lexy::dsl::identifier(lexy::dsl::ascii::alpha);
+    static constexpr auto value
+        = lexy::as_interned<lexy::intern_table<char>>.table(&parse_state::identifiers);
+};
+
+struct identifier_list
+{
+    static constexpr auto rule
+        = lexy::dsl::list(lexy::dsl::p<identifier>, lexy::dsl::sep(lexy::dsl::comma));
+    static constexpr auto value = lexy::as_list<std::vector<lexy::interned_string<char>>>;
+};
+
+struct table_identifier
+{
+    static constexpr auto rule  = lexy::dsl::identifier(lexy::dsl::ascii::alpha);
+    static constexpr auto value = lexy::as_interned<lexy::intern_table<char>>;
+};
+} // namespace
+
+TEST_CASE("as_interned")
+{
+    SUBCASE("table from state")
+    {
+        parse_state state;
+
+        auto result
+            = lexy::parse<identifier_list>(lexy::zstring_input("abc,de,abc,f,de"), state, lexy::noop);
+        REQUIRE(result);
+        CHECK(state.identifiers.size() == 3);
+
+        auto& ids = result.value();
+        REQUIRE(ids.size() == 5);
+        CHECK(ids[0] == ids[2]);
+        CHECK(ids[1] == ids[4]);
+        CHECK(ids[0] != ids[1]);
+        CHECK(ids[0].c_str() == std::string("abc"));
+        CHECK(ids[3].c_str() == std::string("f"));
+    }
+    SUBCASE("state is table")
+    {
+        lexy::intern_table<char> table;
+        auto                     abc = table.intern("abc", 3);
+
+        auto result = lexy::parse<table_identifier>(lexy::zstring_input("abc"), table, lexy::noop);
+        REQUIRE(result);
+        CHECK(result.value() == abc);
+    }
+}
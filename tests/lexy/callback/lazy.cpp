@@ -0,0 +1,100 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/callback/lazy.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/action/parse.hpp>
+#include <lexy/callback/adapter.hpp>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/capture.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/newline.hpp>
+#include <lexy/dsl/production.hpp>
+#include <lexy/dsl/until.hpp>
+#include <lexy/input/string_input.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+int construction_count = 0;
+
+struct record
+{
+    std::string line;
+
+    explicit record(std::string line) : line(LEXY_MOV(line))
+    {
+        ++construction_count;
+    }
+};
+
+using input_t = lexy::string_input<lexy::utf8_encoding>;
+
+constexpr auto make_record = lexy::callback<record>([](auto lexeme) {
+    return record(std::string(lexeme.begin(), lexeme.end()));
+});
+
+struct lazy_record
+{
+    static constexpr auto rule  = lexy::dsl::capture(lexy::dsl::until(lexy::dsl::newline));
+    static constexpr auto value = lexy::as_lazy<input_t>(make_record);
+};
+
+struct records
+{
+    static constexpr auto rule  = lexy::dsl::list(lexy::dsl::p<lazy_record>);
+    static constexpr auto value = lexy::as_list<std::vector<lexy::lazy_for<record, input_t>>>;
+};
+} // namespace
+
+TEST_CASE("as_lazy")
+{
+    auto input = lexy::zstring_input<lexy::utf8_encoding>("abc\n");
+    auto lexeme = lexy::lexeme_for<input_t>(input.data(), input.data() + 3);
+
+    construction_count = 0;
+    auto lazy          = lexy::as_lazy<input_t>(make_record)(lexeme);
+    CHECK(construction_count == 0);
+    CHECK(lazy.get_lexeme().begin() == lexeme.begin());
+    CHECK(lazy.get_lexeme().end() == lexeme.end());
+
+    auto value = lazy.get();
+    CHECK(construction_count == 1);
+    CHECK(value.line == "abc");
+
+    // It's not cached.
+    (void)lazy.get();
+    CHECK(construction_count == 2);
+}
+
+TEST_CASE("materialize")
+{
+    auto input = lexy::zstring_input<lexy::utf8_encoding>("a\nERROR b\nc\nERROR d\n");
+
+    construction_count = 0;
+    auto result        = lexy::parse<records>(input, lexy::noop);
+    REQUIRE(result);
+    REQUIRE(result.value().size() == 4);
+    CHECK(construction_count == 0);
+
+    SUBCASE("all")
+    {
+        auto values = lexy::materialize<std::vector<record>>(result.value());
+        CHECK(construction_count == 4);
+        REQUIRE(values.size() == 4);
+        CHECK(values[0].line == "a\n");
+        CHECK(values[3].line == "ERROR d\n");
+    }
+    SUBCASE("filtered")
+    {
+        auto values = lexy::materialize<std::vector<record>>(result.value(), [](auto lexeme) {
+            return *lexeme.begin() == 'E';
+        });
+        CHECK(construction_count == 2);
+        REQUIRE(values.size() == 2);
+        CHECK(values[0].line == "ERROR b\n");
+        CHECK(values[1].line == "ERROR d\n");
+    }
+}
@@ -8,6 +8,7 @@
 #include <lexy/dsl/option.hpp>
 #include <lexy/input/string_input.hpp>
 #include <string>
+#include <string_view>
 
 TEST_CASE("_detail::encode_code_point")
 {
@@ -273,3 +274,104 @@ TEST_CASE("as_string")
     }
 }
 
+
+TEST_CASE("as_string_view_or_owned")
+{
+    auto input       = lexy::zstring_input("AbCdE");
+    auto char_lexeme = [&] {
+        auto reader = input.reader();
+
+        auto begin = reader.position();
+        reader.bump();
+        reader.bump();
+        reader.bump();
+
+        return lexy::lexeme(reader, begin);
+    }();
+    auto next_lexeme = lexy::lexeme_for<decltype(input)>(input.data() + 3, input.data() + 5);
+    auto uchar_lexeme = [] {
+        auto input  = lexy::zstring_input<lexy::byte_encoding>("AbC");
+        auto reader = input.reader();
+
+        auto begin = reader.position();
+        reader.bump();
+        reader.bump();
+        reader.bump();
+
+        return lexy::lexeme(reader, begin);
+    }();
+
+    constexpr auto callback = lexy::as_string_view_or_owned<std::string, lexy::utf8_encoding>;
+
+    auto from_nullopt = callback(lexy::nullopt{});
+    CHECK(!from_nullopt.is_owned());
+    CHECK(from_nullopt.empty());
+
+    auto from_rvalue = callback(std::string("test"));
+    CHECK(from_rvalue.is_owned());
+    CHECK(from_rvalue.view<std::string_view>() == "test");
+
+    auto from_char_range = callback(char_lexeme.begin(), char_lexeme.end());
+    CHECK(!from_char_range.is_owned());
+    CHECK(from_char_range.data() == input.data());
+    CHECK(from_char_range.view<std::string_view>() == "AbC");
+
+    auto from_char_lexeme = callback(char_lexeme);
+    CHECK(!from_char_lexeme.is_owned());
+    CHECK(from_char_lexeme.data() == input.data());
+    CHECK(from_char_lexeme.size() == 3);
+    CHECK(from_char_lexeme.to_string() == "AbC");
+
+    auto from_uchar_lexeme = callback(uchar_lexeme);
+    CHECK(from_uchar_lexeme.is_owned());
+    CHECK(from_uchar_lexeme.view<std::string_view>() == "AbC");
+
+    auto from_cp = callback(lexy::code_point(0x00E4));
+    CHECK(from_cp.is_owned());
+    CHECK(from_cp.view<std::string_view>() == "\u00E4");
+
+    SUBCASE("sink view")
+    {
+        auto sink = callback.sink();
+        sink(char_lexeme);
+        sink(lexy::lexeme_for<decltype(input)>(input.data() + 3, input.data() + 3));
+        sink(next_lexeme);
+
+        auto result = LEXY_MOV(sink).finish();
+        CHECK(!result.is_owned());
+        CHECK(result.data() == input.data());
+        CHECK(result.view<std::string_view>() == "AbCdE");
+        CHECK(LEXY_MOV(result).to_string() == "AbCdE");
+    }
+    SUBCASE("sink empty")
+    {
+        auto sink   = callback.sink();
+        auto result = LEXY_MOV(sink).finish();
+        CHECK(!result.is_owned());
+        CHECK(result.empty());
+    }
+    SUBCASE("sink owned")
+    {
+        auto sink = callback.sink();
+        sink(char_lexeme);
+        sink(lexy::code_point(0x00E4));
+        sink(next_lexeme);
+        sink('a');
+        sink(char_lexeme);
+        sink(std::string("hi"));
+
+        auto result = LEXY_MOV(sink).finish();
+        CHECK(result.is_owned());
+        CHECK(result.view<std::string_view>() == "AbC\u00E4dEaAbChi");
+    }
+    SUBCASE("sink not adjacent")
+    {
+        auto sink = callback.sink();
+        sink(next_lexeme);
+        sink(char_lexeme);
+
+        auto result = LEXY_MOV(sink).finish();
+        CHECK(result.is_owned());
+        CHECK(result.view<std::string_view>() == "dEAbC");
+    }
+}
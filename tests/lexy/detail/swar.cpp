@@ -4,6 +4,7 @@
 #include <lexy/_detail/swar.hpp>
 
 #include <doctest/doctest.h>
+#include <lexy/input/string_input.hpp>
 
 using namespace lexy::_detail;
 
@@ -141,3 +142,23 @@ TEST_CASE("swar_has_char")
     }
 }
 
+
+TEST_CASE("bounded swar reader")
+{
+    auto input  = lexy::zstring_input("abcdefghijk");
+    auto reader = input.reader();
+    CHECK(is_bounded_swar_reader<decltype(reader)>);
+    CHECK(has_swar<decltype(reader)>);
+
+    CHECK(swar_available(reader));
+    CHECK(peek_swar(reader) == swar_pack('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h').value);
+
+    bump_swar(reader, 3);
+    CHECK(reader.position() == input.data() + 3);
+    CHECK(swar_available(reader));
+    CHECK(peek_swar(reader) == swar_pack('d', 'e', 'f', 'g', 'h', 'i', 'j', 'k').value);
+
+    bump_swar(reader);
+    CHECK(reader.position() == input.data() + 11);
+    CHECK(!swar_available(reader));
+}
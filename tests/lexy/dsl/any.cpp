@@ -31,6 +31,9 @@ TEST_CASE("dsl::any")
     auto swar_long = LEXY_VERIFY(lexy::utf8_char_encoding{}, "123456789012345678901234567890");
     CHECK(swar_long.status == test_result::success);
     CHECK(swar_long.trace == test_trace().token("any", "123456789012345678901234567890"));
+    auto swar_long_utf16 = LEXY_VERIFY(u"123456789012345678901234567890");
+    CHECK(swar_long_utf16.status == test_result::success);
+    CHECK(swar_long_utf16.trace == test_trace().token("any", "123456789012345678901234567890"));
 
     auto swar_unicode
         = LEXY_VERIFY(lexy::utf8_char_encoding{}, "123456789\u00E401234567890\u00E51234567890");
@@ -6,6 +6,7 @@
 #include "verify.hpp"
 #include <cctype>
 #include <lexy/dsl/identifier.hpp>
+#include <string>
 
 namespace
 {
@@ -57,6 +58,26 @@ void test(const char* name, Rule rule, Predicate pred)
         auto swar_utf32_wrong = rule.template char_class_match_swar<lexy::utf32_encoding>(
             lexy::_detail::swar_fill(char32_t(0xFF00 | c)));
         CHECK(!swar_utf32_wrong);
+
+        auto swar_utf16 = rule.template char_class_match_swar<lexy::utf16_encoding>(
+            lexy::_detail::swar_fill(char16_t(c)));
+        if (swar_utf16)
+            CHECK(pred(c));
+        if (!pred(c))
+            CHECK(!swar_utf16);
+
+        auto swar_utf16_wrong = rule.template char_class_match_swar<lexy::utf16_encoding>(
+            lexy::_detail::swar_fill(char16_t(0xFF00 | c)));
+        CHECK(!swar_utf16_wrong);
+
+        // A char with all bits set must not overflow into the next one.
+        auto swar_utf16_overflow = rule.template char_class_match_swar<lexy::utf16_encoding>(
+            lexy::_detail::swar_pack(char16_t(0xFFFF), char16_t(c), char16_t(c), char16_t(c))
+                .value);
+        CHECK(!swar_utf16_overflow);
+        auto swar_utf32_overflow = rule.template char_class_match_swar<lexy::utf32_encoding>(
+            lexy::_detail::swar_pack(char32_t(0xFFFF'FFFF), char32_t(c)).value);
+        CHECK(!swar_utf32_overflow);
     }
 
     auto utf16 = LEXY_VERIFY(u"A");
@@ -79,7 +100,17 @@ bool test_swar(Rule, const char* str)
 
     auto input  = lexy::buffer<lexy::utf8_char_encoding>(str, std::strlen(str));
     auto reader = input.reader();
-    return lexy::try_match_token(rule, reader) && reader.peek() == lexy::utf8_char_encoding::eof();
+    auto result
+        = lexy::try_match_token(rule, reader) && reader.peek() == lexy::utf8_char_encoding::eof();
+
+    auto str_utf16    = std::u16string(str, str + std::strlen(str));
+    auto input_utf16  = lexy::string_input<lexy::utf16_encoding>(str_utf16);
+    auto reader_utf16 = input_utf16.reader();
+    auto result_utf16 = lexy::try_match_token(rule, reader_utf16)
+                        && reader_utf16.peek() == lexy::utf16_encoding::eof();
+    CHECK(result_utf16 == result);
+
+    return result;
 }
 } // namespace
 
@@ -4,9 +4,13 @@
 #include <lexy/dsl/byte.hpp>
 
 #include "verify.hpp"
+#include <forward_list>
+#include <lexy/callback/fold.hpp>
 #include <lexy/dsl/ascii.hpp>
 #include <lexy/dsl/identifier.hpp>
 #include <lexy/dsl/if.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/input/range_input.hpp>
 
 TEST_CASE("dsl::byte")
 {
@@ -381,3 +385,283 @@ TEST_CASE("dsl::bint")
         }
     }
 }
+
+namespace
+{
+// Sums up all integers of the array.
+struct bint_sum
+{
+    using return_type = int;
+
+    template <typename Iterator>
+    constexpr int operator()(Iterator) const
+    {
+        return 0;
+    }
+    template <typename Iterator>
+    constexpr int operator()(Iterator, int sum) const
+    {
+        return sum;
+    }
+
+    constexpr auto sink() const
+    {
+        return lexy::fold_inplace<int>(0, [](int& sum, auto i) { sum += static_cast<int>(i); })
+            .sink();
+    }
+};
+
+// Counts the integers of the array and remembers how many the sink reserved.
+struct bint_reserve
+{
+    static inline std::size_t reserved = 0;
+
+    using return_type = int;
+
+    template <typename Iterator>
+    int operator()(Iterator) const
+    {
+        return 0;
+    }
+    template <typename Iterator>
+    int operator()(Iterator, std::size_t count) const
+    {
+        return static_cast<int>(count);
+    }
+
+    struct _sink
+    {
+        std::size_t count = 0;
+
+        using return_type = std::size_t;
+
+        void reserve(std::size_t n)
+        {
+            reserved = n;
+        }
+
+        template <typename T>
+        void operator()(T)
+        {
+            ++count;
+        }
+
+        std::size_t finish() &&
+        {
+            return count;
+        }
+    };
+
+    auto sink() const
+    {
+        return _sink{};
+    }
+};
+} // namespace
+
+TEST_CASE("dsl::bint.array()")
+{
+    constexpr auto callback = bint_sum{};
+
+    SUBCASE("big")
+    {
+        constexpr auto rule = dsl::big_bint16.array(dsl::bint8);
+        CHECK(lexy::is_branch_rule<decltype(rule)>);
+
+        auto empty = LEXY_VERIFY(lexy::byte_encoding{});
+        CHECK(empty.status == test_result::fatal_error);
+        CHECK(empty.trace == test_trace().expected_char_class(0, "byte").cancel());
+
+        auto zero = LEXY_VERIFY(lexy::byte_encoding{}, 0);
+        CHECK(zero.status == test_result::success);
+        CHECK(zero.value == 0);
+        CHECK(zero.trace == test_trace().token("any", "\\00"));
+
+        auto two = LEXY_VERIFY(lexy::byte_encoding{}, 2, 1, 2, 3, 4);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 0x0102 + 0x0304);
+        CHECK(two.trace == test_trace().token("any", "\\02").token("any", "\\01\\02\\03\\04"));
+
+        auto more = LEXY_VERIFY(lexy::byte_encoding{}, 1, 1, 2, 3, 4);
+        CHECK(more.status == test_result::success);
+        CHECK(more.value == 0x0102);
+        CHECK(more.trace == test_trace().token("any", "\\01").token("any", "\\01\\02"));
+
+        auto not_enough = LEXY_VERIFY(lexy::byte_encoding{}, 2, 1, 2, 3);
+        CHECK(not_enough.status == test_result::fatal_error);
+        CHECK(not_enough.trace
+              == test_trace()
+                     .token("any", "\\02")
+                     .error_token("\\01\\02\\03")
+                     .expected_char_class(4, "byte")
+                     .cancel());
+    }
+    SUBCASE("little")
+    {
+        constexpr auto rule = dsl::little_bint16.array(dsl::bint8);
+
+        auto two = LEXY_VERIFY(lexy::byte_encoding{}, 2, 1, 2, 3, 4);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 0x0201 + 0x0403);
+        CHECK(two.trace == test_trace().token("any", "\\02").token("any", "\\01\\02\\03\\04"));
+    }
+    SUBCASE("as branch")
+    {
+        constexpr auto rule = dsl::if_(dsl::big_bint16.array(dsl::bint8));
+
+        auto empty = LEXY_VERIFY(lexy::byte_encoding{});
+        CHECK(empty.status == test_result::success);
+        CHECK(empty.value == 0);
+        CHECK(empty.trace == test_trace());
+
+        auto two = LEXY_VERIFY(lexy::byte_encoding{}, 2, 1, 2, 3, 4);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 0x0102 + 0x0304);
+        CHECK(two.trace == test_trace().token("any", "\\02").token("any", "\\01\\02\\03\\04"));
+    }
+    SUBCASE("forward iterators")
+    {
+        constexpr auto rule = dsl::big_bint16.array(dsl::bint8);
+
+        using input_t = lexy::range_input<lexy::byte_encoding,
+                                          std::forward_list<unsigned char>::const_iterator>;
+
+        std::forward_list<unsigned char> two_list = {2, 1, 2, 3, 4};
+        auto two = lexy_test::verify(rule, input_t(two_list.begin(), two_list.end()), callback);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 0x0102 + 0x0304);
+
+        std::forward_list<unsigned char> not_enough_list = {2, 1, 2, 3};
+        auto                             not_enough
+            = lexy_test::verify(rule, input_t(not_enough_list.begin(), not_enough_list.end()),
+                                callback);
+        CHECK(not_enough.status == test_result::fatal_error);
+    }
+    SUBCASE("reserve")
+    {
+        constexpr auto rule     = dsl::bint8.array(dsl::little_bint32);
+        constexpr auto callback = bint_reserve{};
+
+        bint_reserve::reserved = 0;
+        auto two               = LEXY_VERIFY_RUNTIME(lexy::byte_encoding{}, 2, 0, 0, 0, 1, 2);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 2);
+        CHECK(bint_reserve::reserved == 2);
+
+        // The count isn't reserved before we know that the input is long enough.
+        bint_reserve::reserved = 0;
+        auto huge = LEXY_VERIFY_RUNTIME(lexy::byte_encoding{}, 0xFF, 0xFF, 0xFF, 0x7F, 1, 2);
+        CHECK(huge.status == test_result::fatal_error);
+        CHECK(bint_reserve::reserved == 0);
+
+        using input_t = lexy::range_input<lexy::byte_encoding,
+                                          std::forward_list<unsigned char>::const_iterator>;
+
+        std::forward_list<unsigned char> huge_list = {0xFF, 0xFF, 0xFF, 0x7F, 1, 2};
+        auto huge_forward = lexy_test::verify(rule, input_t(huge_list.begin(), huge_list.end()),
+                                              callback);
+        CHECK(huge_forward.status == test_result::fatal_error);
+        CHECK(bint_reserve::reserved == 0);
+    }
+}
+
+TEST_CASE("dsl::blob()")
+{
+    SUBCASE("lexeme")
+    {
+        constexpr auto rule = dsl::blob(dsl::bint8);
+        CHECK(lexy::is_branch_rule<decltype(rule)>);
+
+        constexpr auto callback = [](const unsigned char*, auto lex) { return int(lex.size()); };
+
+        auto empty = LEXY_VERIFY(lexy::byte_encoding{});
+        CHECK(empty.status == test_result::fatal_error);
+        CHECK(empty.trace == test_trace().expected_char_class(0, "byte").cancel());
+
+        auto zero = LEXY_VERIFY(lexy::byte_encoding{}, 0);
+        CHECK(zero.status == test_result::success);
+        CHECK(zero.value == 0);
+        CHECK(zero.trace == test_trace().token("any", "\\00"));
+
+        auto three = LEXY_VERIFY(lexy::byte_encoding{}, 3, 1, 2, 3);
+        CHECK(three.status == test_result::success);
+        CHECK(three.value == 3);
+        CHECK(three.trace == test_trace().token("any", "\\03").token("any", "\\01\\02\\03"));
+
+        auto more = LEXY_VERIFY(lexy::byte_encoding{}, 1, 1, 2, 3);
+        CHECK(more.status == test_result::success);
+        CHECK(more.value == 1);
+        CHECK(more.trace == test_trace().token("any", "\\01").token("any", "\\01"));
+
+        auto not_enough = LEXY_VERIFY(lexy::byte_encoding{}, 3, 1, 2);
+        CHECK(not_enough.status == test_result::fatal_error);
+        CHECK(not_enough.trace
+              == test_trace()
+                     .token("any", "\\03")
+                     .error_token("\\01\\02")
+                     .expected_char_class(3, "byte")
+                     .cancel());
+    }
+    SUBCASE("forward iterators")
+    {
+        constexpr auto rule = dsl::blob(dsl::bint8);
+
+        constexpr auto callback = [](auto, auto lex) {
+            auto size = 0;
+            for (auto iter = lex.begin(); iter != lex.end(); ++iter)
+                ++size;
+            return size;
+        };
+
+        using input_t = lexy::range_input<lexy::byte_encoding,
+                                          std::forward_list<unsigned char>::const_iterator>;
+
+        std::forward_list<unsigned char> three_list = {3, 1, 2, 3};
+        auto three
+            = lexy_test::verify(rule, input_t(three_list.begin(), three_list.end()), callback);
+        CHECK(three.status == test_result::success);
+        CHECK(three.value == 3);
+
+        std::forward_list<unsigned char> not_enough_list = {3, 1, 2};
+        auto                             not_enough
+            = lexy_test::verify(rule, input_t(not_enough_list.begin(), not_enough_list.end()),
+                                callback);
+        CHECK(not_enough.status == test_result::fatal_error);
+    }
+    SUBCASE("content")
+    {
+        constexpr auto rule = dsl::blob(dsl::bint8)(dsl::big_bint16) + dsl::bint8;
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        constexpr auto callback
+            = [](const unsigned char*, int content, int next) { return content + next; };
+
+        auto two = LEXY_VERIFY(lexy::byte_encoding{}, 2, 1, 2, 42);
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 0x0102 + 42);
+        CHECK(two.trace
+              == test_trace().token("any", "\\02").token("any", "\\01\\02").token("any", "\\2A"));
+
+        // The content rule can't consume more than the blob.
+        auto one = LEXY_VERIFY(lexy::byte_encoding{}, 1, 1, 2, 42);
+        CHECK(one.status == test_result::fatal_error);
+        CHECK(one.trace
+              == test_trace()
+                     .token("any", "\\01")
+                     .error_token("\\01")
+                     .expected_char_class(2, "byte")
+                     .cancel());
+
+        // The content rule has to consume the entire blob.
+        auto three = LEXY_VERIFY(lexy::byte_encoding{}, 3, 1, 2, 3, 42);
+        CHECK(three.status == test_result::recovered_error);
+        CHECK(three.value == 0x0102 + 42);
+        CHECK(three.trace
+              == test_trace()
+                     .token("any", "\\03")
+                     .token("any", "\\01\\02")
+                     .error(3, 3, "expected EOF")
+                     .error_token("\\03")
+                     .token("any", "\\2A"));
+    }
+}
@@ -41,6 +41,53 @@ TEST_CASE("dsl::ascii::case_folding")
     CHECK(aBc.trace == test_trace().literal("aBc"));
 }
 
+TEST_CASE("dsl::ascii::case_folding - SWAR")
+{
+    constexpr auto rule = dsl::ascii::case_folding(LEXY_LIT("select-all_12"));
+    CHECK(lexy::is_literal_rule<decltype(rule)>);
+
+    auto callback = token_callback;
+
+    auto lower = LEXY_VERIFY(lexy::utf8_char_encoding{}, "select-all_12");
+    CHECK(lower.status == test_result::success);
+    CHECK(lower.trace == test_trace().literal("select-all_12"));
+    auto upper = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SELECT-ALL_12");
+    CHECK(upper.status == test_result::success);
+    CHECK(upper.trace == test_trace().literal("SELECT-ALL_12"));
+    auto mixed = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SeLeCt-AlL_12 and more");
+    CHECK(mixed.status == test_result::success);
+    CHECK(mixed.trace == test_trace().literal("SeLeCt-AlL_12"));
+
+    auto partial = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SELECT-AL");
+    CHECK(partial.status == test_result::fatal_error);
+    CHECK(partial.trace
+          == test_trace()
+                 .error_token("SELECT-AL")
+                 .expected_literal(0, "select-all_12", 9)
+                 .cancel());
+    auto mismatch = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SELECT-ANY_12");
+    CHECK(mismatch.status == test_result::fatal_error);
+    CHECK(mismatch.trace
+          == test_trace()
+                 .error_token("SELECT-A")
+                 .expected_literal(0, "select-all_12", 8)
+                 .cancel());
+
+    // Only letters are case insensitive, so the case bit must not be ignored elsewhere.
+    auto control = LEXY_VERIFY(lexy::utf8_char_encoding{}, "select\rall_12");
+    CHECK(control.status == test_result::fatal_error);
+    CHECK(control.trace
+          == test_trace().error_token("select").expected_literal(0, "select-all_12", 6).cancel());
+    auto digit = LEXY_VERIFY(lexy::utf8_char_encoding{}, "select-all_\x11"
+                                                         "2");
+    CHECK(digit.status == test_result::fatal_error);
+    CHECK(digit.trace
+          == test_trace()
+                 .error_token("select-all_")
+                 .expected_literal(0, "select-all_12", 11)
+                 .cancel());
+}
+
 TEST_CASE("dsl::unicode::simple_case_folding, UTF-32")
 {
     constexpr auto rule = dsl::unicode::simple_case_folding(LEXY_LIT(U"abć"));
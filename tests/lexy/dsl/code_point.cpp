@@ -4,6 +4,7 @@
 #include <lexy/dsl/code_point.hpp>
 
 #include "verify.hpp"
+#include <lexy/dsl/identifier.hpp>
 
 using lexy::_detail::cp_error;
 
@@ -302,6 +303,21 @@ TEST_CASE("UTF-16 code point parsing")
             }
         }
     }
+    SUBCASE("supplementary planes")
+    {
+        for (auto i = 0x10000; i <= 0x10FFFF; ++i)
+        {
+            INFO(i);
+
+            char16_t str[3] = {};
+            lexy::_detail::encode_code_point<lexy::utf16_encoding>(char32_t(i), str, 2);
+
+            auto result = parse(str);
+            CHECK(result);
+            CHECK(result.count == 2);
+            CHECK(result.value == i);
+        }
+    }
 }
 
 TEST_CASE("UTF-32 code point parsing")
@@ -405,6 +421,40 @@ TEST_CASE("dsl::code_point")
     auto emoji = LEXY_VERIFY(u"🙂");
     CHECK(emoji.status == test_result::success);
     CHECK(emoji.trace == test_trace().token("any", "\\U0001F642"));
+
+    SUBCASE("swar")
+    {
+        using lexy::_detail::swar_fill;
+        using lexy::_detail::swar_pack;
+
+        CHECK(rule.char_class_match_swar<lexy::utf8_encoding>(swar_fill(LEXY_CHAR8_T('a'))));
+        CHECK(!rule.char_class_match_swar<lexy::utf8_encoding>(
+            swar_pack(LEXY_CHAR8_T('a'), LEXY_CHAR8_T(0xC3), LEXY_CHAR8_T(0xA4)).value));
+
+        CHECK(rule.char_class_match_swar<lexy::utf16_encoding>(
+            swar_pack(u'a', u'\u00E4', u'\u20AC', u'z').value));
+        CHECK(rule.char_class_match_swar<lexy::utf16_encoding>(
+            swar_pack(u'a', char16_t(0xD83D), char16_t(0xDE42), u'z').value));
+        CHECK(!rule.char_class_match_swar<lexy::utf16_encoding>(
+            swar_pack(u'a', u'b', u'c', char16_t(0xD83D)).value));
+        CHECK(!rule.char_class_match_swar<lexy::utf16_encoding>(
+            swar_pack(char16_t(0xDE42), u'a', u'b', u'c').value));
+        CHECK(!rule.char_class_match_swar<lexy::utf16_encoding>(
+            swar_pack(u'a', char16_t(0xDE42), char16_t(0xD83D), u'b').value));
+
+        constexpr auto pattern = lexy::dsl::identifier(rule).pattern();
+
+        auto input  = lexy::zstring_input(u"abc🙂defghij🙂kl🙂");
+        auto reader = input.reader();
+        CHECK(lexy::try_match_token(pattern, reader));
+        CHECK(reader.peek() == lexy::utf16_encoding::eof());
+
+        const char16_t lone_surrogate[] = {u'a', u'b', u'c', u'd', u'e', char16_t(0xDE42), u'f'};
+        auto lone_input  = lexy::string_input(lone_surrogate, 7);
+        auto lone_reader = lone_input.reader();
+        CHECK(lexy::try_match_token(pattern, lone_reader));
+        CHECK(lone_reader.position() == lone_surrogate + 5);
+    }
 }
 
 TEST_CASE("dsl::code_point.if_()")
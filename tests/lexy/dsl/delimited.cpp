@@ -637,6 +637,70 @@ TEST_CASE("dsl::delimited(open, close) - SWAR")
                  .literal(")"));
 }
 
+TEST_CASE("dsl::delimited(open, close) - SWAR block scan")
+{
+    // Everything except control characters, so the entire run up to the next quote, escape, or
+    // control character is skipped at once.
+    constexpr auto rule = dsl::quoted.limit(dsl::ascii::newline) //
+        (-dsl::ascii::control, dsl::backslash_escape.rule(dsl::lit_c<'"'>));
+
+    constexpr delim_callback callback
+        = lexy::callback<int>([](const char*, std::size_t count) { return int(count); });
+
+    auto many = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghijklmnopqrstuvwxyz\"");
+    CHECK(many.status == test_result::success);
+    CHECK(many.value == 26);
+    CHECK(many.trace
+          == test_trace().literal("\"").token("abcdefghijklmnopqrstuvwxyz").literal("\""));
+
+    auto esc = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghijklmno\\\"pqrstuvwxyz\"");
+    CHECK(esc.status == test_result::success);
+    CHECK(esc.value == 26);
+    CHECK(esc.trace
+          == test_trace()
+                 .literal("\"")
+                 .token("abcdefghijklmno")
+                 .literal("\\\\")
+                 .literal("\"")
+                 .token("pqrstuvwxyz")
+                 .literal("\""));
+
+    auto unicode = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghij\u00e4klmnopqrstuvwxyz\"");
+    CHECK(unicode.status == test_result::success);
+    CHECK(unicode.value == 28);
+
+    auto control = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghijk\tlmnopqrstuvwxyz\"");
+    CHECK(control.status == test_result::recovered_error);
+    CHECK(control.value == 26);
+    CHECK(control.trace
+          == test_trace()
+                 .literal("\"")
+                 .token("abcdefghijk")
+                 .expected_char_class(12, "complement")
+                 .recovery()
+                 .error_token("\\t")
+                 .finish()
+                 .token("lmnopqrstuvwxyz")
+                 .literal("\""));
+
+    auto unterminated = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghijklm\nnopqrstuvwxyz\"");
+    CHECK(unterminated.status == test_result::fatal_error);
+    CHECK(unterminated.trace
+          == test_trace()
+                 .literal("\"")
+                 .token("abcdefghijklm")
+                 .error(1, 14, "missing delimiter")
+                 .cancel());
+    auto eof = LEXY_VERIFY(lexy::utf8_char_encoding{}, "\"abcdefghijklmnopqrstuvwxyz");
+    CHECK(eof.status == test_result::fatal_error);
+    CHECK(eof.trace
+          == test_trace()
+                 .literal("\"")
+                 .token("abcdefghijklmnopqrstuvwxyz")
+                 .error(1, 27, "missing delimiter")
+                 .cancel());
+}
+
 TEST_CASE("dsl::delimited(delim)")
 {
     CHECK(equivalent_rules(dsl::delimited(dsl::lit_c<'"'>),
@@ -195,6 +195,9 @@ TEST_CASE("dsl::digits<>")
     auto swar = LEXY_VERIFY(lexy::utf8_encoding{}, LEXY_CHAR8_STR("123456789123456789"));
     CHECK(swar.status == test_result::success);
     CHECK(swar.trace == test_trace().token("digits", "123456789123456789"));
+    auto swar_utf16 = LEXY_VERIFY(u"123456789123456789");
+    CHECK(swar_utf16.status == test_result::success);
+    CHECK(swar_utf16.trace == test_trace().token("digits", "123456789123456789"));
 }
 
 TEST_CASE("dsl::digits<>.no_leading_zero()")
@@ -233,6 +236,9 @@ TEST_CASE("dsl::digits<>.no_leading_zero()")
     auto swar = LEXY_VERIFY(lexy::utf8_encoding{}, LEXY_CHAR8_STR("123456789123456789"));
     CHECK(swar.status == test_result::success);
     CHECK(swar.trace == test_trace().token("digits", "123456789123456789"));
+    auto swar_utf16 = LEXY_VERIFY(u"123456789123456789");
+    CHECK(swar_utf16.status == test_result::success);
+    CHECK(swar_utf16.trace == test_trace().token("digits", "123456789123456789"));
 }
 
 TEST_CASE("dsl::digits<>.sep()")
@@ -282,6 +288,9 @@ TEST_CASE("dsl::digits<>.sep()")
     auto swar = LEXY_VERIFY(lexy::utf8_encoding{}, LEXY_CHAR8_STR("123456789123456789"));
     CHECK(swar.status == test_result::success);
     CHECK(swar.trace == test_trace().token("digits", "123456789123456789"));
+    auto swar_utf16 = LEXY_VERIFY(u"123456789123456789");
+    CHECK(swar_utf16.status == test_result::success);
+    CHECK(swar_utf16.trace == test_trace().token("digits", "123456789123456789"));
 }
 
 TEST_CASE("dsl::digits<>.sep().no_leading_zero")
@@ -337,6 +346,9 @@ TEST_CASE("dsl::digits<>.sep().no_leading_zero")
     auto swar = LEXY_VERIFY(lexy::utf8_encoding{}, LEXY_CHAR8_STR("123456789123456789"));
     CHECK(swar.status == test_result::success);
     CHECK(swar.trace == test_trace().token("digits", "123456789123456789"));
+    auto swar_utf16 = LEXY_VERIFY(u"123456789123456789");
+    CHECK(swar_utf16.status == test_result::success);
+    CHECK(swar_utf16.trace == test_trace().token("digits", "123456789123456789"));
 }
 
 TEST_CASE("digit separators")
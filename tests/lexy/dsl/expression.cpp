@@ -988,6 +988,89 @@ TEST_CASE("expression - nested operations")
     // clang-format on
 }
 
+namespace common_prefix
+{
+constexpr auto op_and     = dsl::op(LEXY_LIT("&&"));
+constexpr auto op_bit_and = dsl::op(dsl::lit_c<'&'>);
+
+struct logical_bitwise : lexy::expression_production, test_production
+{
+    static constexpr auto atom = integer;
+
+    struct bit_and : dsl::infix_op_left
+    {
+        static constexpr auto name = "bit_and";
+        static constexpr auto op   = op_bit_and;
+        using operand              = dsl::atom;
+    };
+    struct logical_and : dsl::infix_op_left
+    {
+        static constexpr auto name = "logical_and";
+        static constexpr auto op   = op_and;
+        using operand              = bit_and;
+    };
+    using operation = logical_and;
+};
+} // namespace common_prefix
+
+TEST_CASE("expression - operators with common prefix")
+{
+    using namespace common_prefix;
+    auto callback = lexy::callback<int>([](const char*, int value) { return value; },
+                                        [](const char*, int lhs, lexy::op<op_and>, int rhs) {
+                                            return lhs + rhs;
+                                        },
+                                        [](const char*, int lhs, lexy::op<op_bit_and>, int rhs) {
+                                            return lhs * rhs;
+                                        });
+
+    using prod = logical_bitwise;
+
+    auto a = LEXY_OP_VERIFY("1&&2");
+    CHECK(a.status == test_result::success);
+    CHECK(a.value == 3);
+    CHECK(a.tree
+          == test_tree(prod{}).production("logical_and").digits("1").literal("&&").digits("2"));
+    auto b = LEXY_OP_VERIFY("2&3");
+    CHECK(b.status == test_result::success);
+    CHECK(b.value == 6);
+    CHECK(b.tree == test_tree(prod{}).production("bit_and").digits("2").literal("&").digits("3"));
+
+    // The longest operator is matched, even if an operator with a higher binding power matches a
+    // prefix of it.
+    auto aa = LEXY_OP_VERIFY("1&&2&&3");
+    CHECK(aa.status == test_result::success);
+    CHECK(aa.value == 6);
+    // clang-format off
+    CHECK(aa.tree == test_tree(prod{})
+            .production("logical_and")
+                .production("logical_and")
+                    .digits("1")
+                    .literal("&&")
+                    .digits("2")
+                    .finish()
+                .literal("&&")
+                .digits("3"));
+    // clang-format on
+    auto bab = LEXY_OP_VERIFY("2&3&&4&5");
+    CHECK(bab.status == test_result::success);
+    CHECK(bab.value == 26);
+    // clang-format off
+    CHECK(bab.tree == test_tree(prod{})
+            .production("logical_and")
+                .production("bit_and")
+                    .digits("2")
+                    .literal("&")
+                    .digits("3")
+                    .finish()
+                .literal("&&")
+                .production("bit_and")
+                    .digits("4")
+                    .literal("&")
+                    .digits("5"));
+    // clang-format on
+}
+
 namespace groups
 {
 constexpr auto op_a = dsl::op(LEXY_LIT("a"));
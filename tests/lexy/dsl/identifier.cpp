@@ -5,6 +5,7 @@
 
 #include "verify.hpp"
 #include <cctype>
+#include <cstring>
 #include <lexy/dsl/ascii.hpp>
 #include <lexy/dsl/case_folding.hpp>
 #include <lexy/dsl/if.hpp>
@@ -349,6 +350,74 @@ TEST_CASE("dsl::identifier with case folding")
     CHECK(Int.trace == test_trace().token("identifier", "Int").error(0, 3, "reserved identifier"));
 }
 
+TEST_CASE("dsl::identifier with many reserved identifiers")
+{
+    // The reserved identifiers are looked up in a hash set bucketed by length.
+    // Depending on the length, they're compared using one, two, or more loads.
+    constexpr auto rule
+        = dsl::identifier(dsl::ascii::alpha)
+              .reserve(LEXY_LIT("a"), LEXY_LIT("ab"), LEXY_LIT("abc"), LEXY_LIT("abcd"),
+                       LEXY_LIT("abcdefgh"), LEXY_LIT("abcdefghi"), LEXY_LIT("abcdefghijklmnop"),
+                       LEXY_LIT("abcdefghijklmnopq"), LEXY_LIT("abcdefghijklmnopqrstuvwxyz"));
+
+    constexpr auto callback = [](auto...) { return 0; };
+
+    const char* reserved[] = {"a",
+                              "ab",
+                              "abc",
+                              "abcd",
+                              "abcdefgh",
+                              "abcdefghi",
+                              "abcdefghijklmnop",
+                              "abcdefghijklmnopq",
+                              "abcdefghijklmnopqrstuvwxyz"};
+    for (auto str : reserved)
+    {
+        auto result = LEXY_VERIFY_RUNTIME(str);
+        CHECK(result.status == test_result::recovered_error);
+        CHECK(result.trace
+              == test_trace()
+                     .token("identifier", str)
+                     .error(0, std::strlen(str), "reserved identifier"));
+    }
+
+    const char* not_reserved[] = {"b",
+                                  "ba",
+                                  "abd",
+                                  "bbcd",
+                                  "abcde",
+                                  "abcdefgx",
+                                  "xbcdefghi",
+                                  "abcdxfghi",
+                                  "abcdefghijklmnox",
+                                  "abcdefghxjklmnopq",
+                                  "abcdefghijklmxopqrstuvwxyz",
+                                  "abcdefghijklmnopqrstuvwxyy",
+                                  "abcdefghijklmnopqrstuvwxy"};
+    for (auto str : not_reserved)
+    {
+        auto result = LEXY_VERIFY_RUNTIME(str);
+        CHECK(result.status == test_result::success);
+        CHECK(result.trace == test_trace().token("identifier", str));
+    }
+
+    auto abcd = LEXY_VERIFY("abcd");
+    CHECK(abcd.status == test_result::recovered_error);
+    CHECK(abcd.trace
+          == test_trace().token("identifier", "abcd").error(0, 4, "reserved identifier"));
+    auto abce = LEXY_VERIFY("abce");
+    CHECK(abce.status == test_result::success);
+    CHECK(abce.trace == test_trace().token("identifier", "abce"));
+
+    auto utf16_reserved = LEXY_VERIFY(lexy::utf16_encoding{}, u"abcdefghi");
+    CHECK(utf16_reserved.status == test_result::recovered_error);
+    CHECK(utf16_reserved.trace
+          == test_trace().token("identifier", "abcdefghi").error(0, 9, "reserved identifier"));
+    auto utf16 = LEXY_VERIFY(lexy::utf16_encoding{}, u"abcdxfghi");
+    CHECK(utf16.status == test_result::success);
+    CHECK(utf16.trace == test_trace().token("identifier", "abcdxfghi"));
+}
+
 TEST_CASE("dsl::keyword")
 {
     constexpr auto id = dsl::identifier(dsl::ascii::alpha).reserve(LEXY_LIT("foo"));
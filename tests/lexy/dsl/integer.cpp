@@ -8,6 +8,7 @@
 #include <cstring>
 #include <lexy/dsl/if.hpp>
 #include <lexy/dsl/loop.hpp>
+#include <random>
 #include <string>
 
 TEST_CASE("_digit_count")
@@ -269,6 +270,62 @@ TEST_CASE("_integer_parser")
         CHECK(parse_int(parser, "0'0'F'F") == 255);
         CHECK(parse_int(parser, "0'0'F'F") == 255);
     }
+
+    SUBCASE("base 10, uint64_t")
+    {
+        constexpr auto parser = dsl::_integer_parser<std::uint64_t, dsl::decimal, false>{};
+
+        std::mt19937_64 engine(42);
+        for (auto i = 0; i < 1024; ++i)
+        {
+            auto value = engine() >> (i % 64);
+            INFO(value);
+
+            auto result = parse_int(parser, std::to_string(value).c_str());
+            CHECK(!result.overflow);
+            CHECK(result.value == value);
+        }
+
+        auto max = parse_int(parser, "000000000000018446744073709551615");
+        CHECK(!max.overflow);
+        CHECK(max.value == UINT64_MAX);
+
+        auto overflow = parse_int(parser, "18446744073709551616");
+        CHECK(overflow.overflow);
+        CHECK(overflow.value == UINT64_MAX / 10 * 10);
+        CHECK(parse_int(parser, "100000000000000000000").overflow);
+
+        auto sep = parse_int(parser, "1234567'12345678'1234");
+        CHECK(!sep.overflow);
+        CHECK(sep.value == 1234567123456781234u);
+    }
+    SUBCASE("base 10, unbounded uint64_t")
+    {
+        constexpr auto parser
+            = dsl::_integer_parser<lexy::unbounded<std::uint64_t>, dsl::decimal, false>{};
+
+        auto value = parse_int(parser, "12345678'12345678'1234");
+        CHECK(value.value == 12345678123456781234u);
+
+        auto wrapped = parse_int(parser, "18446744073709551616");
+        CHECK(wrapped.value == 0);
+    }
+    SUBCASE("base 16, uint64_t")
+    {
+        constexpr auto parser = dsl::_integer_parser<std::uint64_t, dsl::hex, false>{};
+
+        auto digits = parse_int(parser, "0123456789ABCDEF");
+        CHECK(!digits.overflow);
+        CHECK(digits.value == 0x0123456789ABCDEF);
+        auto decimal_block = parse_int(parser, "1234567812345678");
+        CHECK(!decimal_block.overflow);
+        CHECK(decimal_block.value == 0x1234567812345678);
+        auto max = parse_int(parser, "ffffffffffffffff");
+        CHECK(!max.overflow);
+        CHECK(max.value == UINT64_MAX);
+
+        CHECK(parse_int(parser, "10000000000000000").overflow);
+    }
 }
 
 TEST_CASE("dsl::integer(token)")
@@ -532,6 +532,34 @@ TEST_CASE("dsl::literal_set")
         CHECK(HellO.status == test_result::success);
         CHECK(HellO.trace == test_trace().literal("HellO"));
     }
+    SUBCASE("case folding, long")
+    {
+        constexpr auto rule = dsl::literal_set(dsl::ascii::case_folding(LEXY_LIT("select")),
+                                               dsl::ascii::case_folding(LEXY_LIT("selection")),
+                                               dsl::ascii::case_folding(LEXY_LIT("transaction")));
+        CHECK(lexy::is_token_rule<decltype(rule)>);
+        CHECK(lexy::is_literal_set_rule<decltype(rule)>);
+
+        auto select = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SeLeCt");
+        CHECK(select.status == test_result::success);
+        CHECK(select.trace == test_trace().literal("SeLeCt"));
+        auto selection = LEXY_VERIFY(lexy::utf8_char_encoding{}, "SELECTION");
+        CHECK(selection.status == test_result::success);
+        CHECK(selection.trace == test_trace().literal("SELECTION"));
+        auto selectio = LEXY_VERIFY(lexy::utf8_char_encoding{}, "selectio");
+        CHECK(selectio.status == test_result::success);
+        CHECK(selectio.trace == test_trace().literal("select"));
+
+        auto transaction = LEXY_VERIFY(lexy::utf8_char_encoding{}, "TransAction");
+        CHECK(transaction.status == test_result::success);
+        CHECK(transaction.trace == test_trace().literal("TransAction"));
+        auto transact = LEXY_VERIFY(lexy::utf8_char_encoding{}, "transact");
+        CHECK(transact.status == test_result::fatal_error);
+        CHECK(transact.trace == test_trace().error(0, 0, "expected literal set").cancel());
+        auto trans_action = LEXY_VERIFY(lexy::utf8_char_encoding{}, "trans\x01ction");
+        CHECK(trans_action.status == test_result::fatal_error);
+        CHECK(trans_action.trace == test_trace().error(0, 0, "expected literal set").cancel());
+    }
 }
 
 TEST_CASE("LEXY_LITERAL_SET")
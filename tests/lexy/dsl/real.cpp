@@ -0,0 +1,280 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/dsl/real.hpp>
+
+#include "verify.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <lexy/dsl/if.hpp>
+#include <lexy/dsl/option.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/dsl/token.hpp>
+#include <random>
+#include <string>
+
+namespace
+{
+template <typename T>
+T parse_float(const std::string& str)
+{
+    return lexy::_detail::parse_float<T>(str.data(), str.data() + str.size());
+}
+
+template <typename T>
+bool same_bits(T lhs, T rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+bool check_double(const std::string& str)
+{
+    return same_bits(parse_float<double>(str), std::strtod(str.c_str(), nullptr));
+}
+bool check_float(const std::string& str)
+{
+    return same_bits(parse_float<float>(str), std::strtof(str.c_str(), nullptr));
+}
+} // namespace
+
+TEST_CASE("_detail::parse_float")
+{
+    SUBCASE("simple")
+    {
+        CHECK(parse_float<double>("0") == 0.0);
+        CHECK(parse_float<double>("1") == 1.0);
+        CHECK(parse_float<double>("1.5") == 1.5);
+        CHECK(parse_float<double>("-2.25") == -2.25);
+        CHECK(parse_float<double>("0.001") == 0.001);
+        CHECK(parse_float<double>("1e3") == 1000.0);
+        CHECK(parse_float<double>("1E-3") == 0.001);
+        CHECK(parse_float<double>("12.5e+2") == 1250.0);
+        CHECK(parse_float<double>("000123.4500") == 123.45);
+        CHECK(std::signbit(parse_float<double>("-0.0")));
+
+        CHECK(parse_float<float>("0.1") == 0.1f);
+        CHECK(parse_float<float>("3.4028235e38") == 3.4028235e38f);
+    }
+    SUBCASE("edge cases")
+    {
+        std::string cases[] = {
+            // Largest and smallest values.
+            "1.7976931348623157e308",
+            "2.2250738585072014e-308",
+            "2.2250738585072011e-308",
+            "4.9406564584124654e-324",
+            "2.4703282292062328e-324",
+            "2.4703282292062327e-324",
+            "1e-400",
+            "1e400",
+            "1.7976931348623159e308",
+            "1.7976931348623158e308",
+            "0e999999999999",
+            // Exactly halfway between two doubles, round to even.
+            "9007199254740993",
+            "9007199254740995",
+            "9007199254740993.0000000000000000000001",
+            "1.00000000000000011102230246251565404236316680908203125",
+            "1.00000000000000011102230246251565404236316680908203124",
+            "1.00000000000000011102230246251565404236316680908203126",
+            "7.3177701707893310e+15",
+            // More than 19 significant digits.
+            "3.14159265358979323846264338327950288419716939937510",
+            "123456789012345678901234567890",
+            "0.000000000000000000000000000000000012345678901234567890123",
+            "2.22507385850720113605740979670913197593481954635164564802342610972482222202107694551"
+            "65295231206888752983738484897428713040585013051138567962604125046874e-308",
+            "17976931348623158079372897140530341507993413271003782693617377898044496829276475094664"
+            "90178622720378856600227810230718432823405637896566406612049098457155788932183683342566"
+            "012496640" + std::string(160, '0'),
+            // Digits far beyond the 768 that are considered exactly.
+            "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932"
+            "649918841275362644043461031128180408080407068038081082078016080712"
+                + std::string(800, '0') + "1e-324",
+        };
+        for (auto& str : cases)
+        {
+            INFO(str);
+            CHECK(check_double(str));
+        }
+
+        const char* float_cases[] = {"3.4028235e38",
+                                     "3.4028236e38",
+                                     "1.17549435e-38",
+                                     "1.4e-45",
+                                     "7e-46",
+                                     "7.006492321624085e-46",
+                                     "16777217",
+                                     "16777219",
+                                     "1.00000005960464477539062499",
+                                     "1.00000005960464477539062500",
+                                     "1.00000005960464477539062501",
+                                     "0.333333333333333333333333333333"};
+        for (auto str : float_cases)
+        {
+            INFO(str);
+            CHECK(check_float(str));
+        }
+    }
+    SUBCASE("round trip")
+    {
+        std::mt19937_64 engine(42);
+        for (auto i = 0; i != 20000; ++i)
+        {
+            auto bits = engine();
+
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (!std::isfinite(value))
+                continue;
+
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+            INFO(buffer);
+            CHECK(same_bits(parse_float<double>(buffer), value));
+        }
+    }
+    SUBCASE("random digits")
+    {
+        std::mt19937                    engine(1337);
+        std::uniform_int_distribution<> digit(0, 9);
+        std::uniform_int_distribution<> length(1, 40);
+        std::uniform_int_distribution<> exponent(-340, 310);
+        for (auto i = 0; i != 20000; ++i)
+        {
+            std::string str;
+            for (auto n = length(engine); n > 0; --n)
+                str += char('0' + digit(engine));
+            str.insert(str.size() / 2, ".");
+            str += "e" + std::to_string(exponent(engine));
+
+            INFO(str);
+            CHECK(check_double(str));
+            CHECK(check_float(str));
+        }
+    }
+}
+
+TEST_CASE("dsl::real")
+{
+    constexpr auto rule = dsl::real<double>;
+    CHECK(lexy::is_branch_rule<decltype(rule)>);
+
+    // The value is in thousandths, infinity is -1.
+    constexpr auto callback
+        = lexy::callback<int>([](const char*) { return -11; },
+                              [](const char*, double value) {
+                                  return std::isinf(value) ? -1 : static_cast<int>(value * 1000);
+                              });
+
+    auto empty = LEXY_VERIFY_RUNTIME("");
+    CHECK(empty.status == test_result::fatal_error);
+    CHECK(empty.trace == test_trace().expected_char_class(0, "digit.decimal").cancel());
+
+    auto integer = LEXY_VERIFY_RUNTIME("42");
+    CHECK(integer.status == test_result::success);
+    CHECK(integer.value == 42000);
+    CHECK(integer.trace == test_trace().token("digits", "42"));
+
+    auto fraction = LEXY_VERIFY_RUNTIME("3.25");
+    CHECK(fraction.status == test_result::success);
+    CHECK(fraction.value == 3250);
+    CHECK(fraction.trace == test_trace().token("digits", "3.25"));
+
+    auto exponent = LEXY_VERIFY_RUNTIME("1.5e3");
+    CHECK(exponent.status == test_result::success);
+    CHECK(exponent.value == 1500000);
+    CHECK(exponent.trace == test_trace().token("digits", "1.5e3"));
+    auto exponent_sign = LEXY_VERIFY_RUNTIME("25E-2");
+    CHECK(exponent_sign.status == test_result::success);
+    CHECK(exponent_sign.value == 250);
+    CHECK(exponent_sign.trace == test_trace().token("digits", "25E-2"));
+
+    auto huge = LEXY_VERIFY_RUNTIME("1e999");
+    CHECK(huge.status == test_result::success);
+    CHECK(huge.value == -1);
+    CHECK(huge.trace == test_trace().token("digits", "1e999"));
+    auto tiny = LEXY_VERIFY_RUNTIME("1e-999");
+    CHECK(tiny.status == test_result::success);
+    CHECK(tiny.value == 0);
+    CHECK(tiny.trace == test_trace().token("digits", "1e-999"));
+
+    // The number ends before a `.` or `e` that isn't followed by digits.
+    auto missing_fraction = LEXY_VERIFY_RUNTIME("1.");
+    CHECK(missing_fraction.status == test_result::success);
+    CHECK(missing_fraction.value == 1000);
+    CHECK(missing_fraction.trace == test_trace().token("digits", "1"));
+    auto missing_exponent = LEXY_VERIFY_RUNTIME("1e+");
+    CHECK(missing_exponent.status == test_result::success);
+    CHECK(missing_exponent.value == 1000);
+    CHECK(missing_exponent.trace == test_trace().token("digits", "1"));
+    auto fraction_missing_exponent = LEXY_VERIFY_RUNTIME("1.5e");
+    CHECK(fraction_missing_exponent.status == test_result::success);
+    CHECK(fraction_missing_exponent.value == 1500);
+    CHECK(fraction_missing_exponent.trace == test_trace().token("digits", "1.5"));
+
+    auto sign = LEXY_VERIFY_RUNTIME("-1");
+    CHECK(sign.status == test_result::fatal_error);
+    CHECK(sign.trace == test_trace().expected_char_class(0, "digit.decimal").cancel());
+}
+
+TEST_CASE("dsl::real followed by . or e")
+{
+    // The value is in thousandths.
+    constexpr auto callback
+        = lexy::callback<int>([](const char*) { return -11; },
+                              [](const char*, double value) {
+                                  return static_cast<int>(value * 1000);
+                              },
+                              [](const char*, double lhs, double rhs) {
+                                  return static_cast<int>(lhs * 1000 + rhs);
+                              });
+
+    SUBCASE("unit")
+    {
+        constexpr auto rule = dsl::real<double> + LEXY_LIT("em");
+
+        auto em = LEXY_VERIFY_RUNTIME("1.5em");
+        CHECK(em.status == test_result::success);
+        CHECK(em.value == 1500);
+        CHECK(em.trace == test_trace().token("digits", "1.5").literal("em"));
+    }
+    SUBCASE("range")
+    {
+        constexpr auto rule = dsl::real<double> + LEXY_LIT("..") + dsl::real<double>;
+
+        auto range = LEXY_VERIFY_RUNTIME("1..5");
+        CHECK(range.status == test_result::success);
+        CHECK(range.value == 1005);
+        CHECK(range.trace == test_trace().token("digits", "1").literal("..").token("digits", "5"));
+    }
+}
+
+TEST_CASE("dsl::real(token)")
+{
+    constexpr auto number = dsl::token(dsl::opt(dsl::lit_c<'-'>) + dsl::digits<> + dsl::lit_c<'.'>
+                                       + dsl::digits<>);
+    constexpr auto rule   = dsl::if_(dsl::real<float>(number));
+    CHECK(lexy::is_rule<decltype(rule)>);
+
+    constexpr auto callback = lexy::callback<int>([](const char*) { return -11; },
+                                                  [](const char*, float value) {
+                                                      return static_cast<int>(value * 1000);
+                                                  });
+
+    auto empty = LEXY_VERIFY_RUNTIME("");
+    CHECK(empty.status == test_result::success);
+    CHECK(empty.value == -11);
+    CHECK(empty.trace == test_trace());
+
+    auto positive = LEXY_VERIFY_RUNTIME("0.5");
+    CHECK(positive.status == test_result::success);
+    CHECK(positive.value == 500);
+    CHECK(positive.trace == test_trace().token("0.5"));
+    auto negative = LEXY_VERIFY_RUNTIME("-1.25");
+    CHECK(negative.status == test_result::success);
+    CHECK(negative.value == -1250);
+    CHECK(negative.trace == test_trace().token("-1.25"));
+}
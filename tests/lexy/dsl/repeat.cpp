@@ -21,6 +21,46 @@ struct count_production
     static constexpr auto rule  = integer;
     static constexpr auto value = lexy::forward<int>;
 };
+
+// Counts the items of the list and remembers how many the sink reserved.
+struct reserve_callback
+{
+    static inline std::size_t reserved = 0;
+
+    using return_type = int;
+
+    int operator()(const char*, std::size_t n) const
+    {
+        return static_cast<int>(n);
+    }
+
+    struct _sink
+    {
+        std::size_t count = 0;
+
+        using return_type = std::size_t;
+
+        void reserve(std::size_t n)
+        {
+            reserved = n;
+        }
+
+        void operator()(const char*)
+        {
+            ++count;
+        }
+
+        std::size_t finish() &&
+        {
+            return count;
+        }
+    };
+
+    auto sink() const
+    {
+        return _sink{};
+    }
+};
 } // namespace
 
 TEST_CASE("dsl::repeat()")
@@ -230,6 +270,24 @@ TEST_CASE("dsl::repeat()")
                      .expected_literal(2, "a", 0)
                      .cancel());
     }
+    SUBCASE(".list() reserve")
+    {
+        constexpr auto rule
+            = dsl::repeat(dsl::integer<std::size_t>).list(dsl::position + dsl::lit_c<'a'>);
+        constexpr auto callback = reserve_callback{};
+
+        reserve_callback::reserved = 0;
+        auto two                   = LEXY_VERIFY_RUNTIME("2aaa");
+        CHECK(two.status == test_result::success);
+        CHECK(two.value == 2);
+        CHECK(reserve_callback::reserved == 2);
+
+        // The count comes from the input, so we don't reserve more than the remaining input.
+        reserve_callback::reserved = 0;
+        auto huge                  = LEXY_VERIFY_RUNTIME("99999999999999999aaa");
+        CHECK(huge.status == test_result::fatal_error);
+        CHECK(reserve_callback::reserved == 3);
+    }
     SUBCASE(".capture()")
     {
         constexpr auto rule = dsl::repeat(integer).capture(dsl::lit_c<'a'>);
@@ -0,0 +1,155 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/dsl/token_dfa.hpp>
+
+#include "verify.hpp"
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/digit.hpp>
+#include <lexy/dsl/identifier.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/option.hpp>
+
+TEST_CASE("dsl::token_dfa()")
+{
+    SUBCASE("sequence and choice")
+    {
+        constexpr auto rule
+            = dsl::token_dfa(LEXY_LIT("ab") + (dsl::lit_c<'c'> | LEXY_LIT("de")) + LEXY_LIT("!"));
+        CHECK(lexy::is_token_rule<decltype(rule)>);
+
+        constexpr auto callback = token_callback;
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty.status == test_result::fatal_error);
+        CHECK(empty.trace == test_trace().error(0, 0, "missing token").cancel());
+
+        auto abc = LEXY_VERIFY("abc!");
+        CHECK(abc.status == test_result::success);
+        CHECK(abc.trace == test_trace().token("abc!"));
+        auto abde = LEXY_VERIFY("abde!");
+        CHECK(abde.status == test_result::success);
+        CHECK(abde.trace == test_trace().token("abde!"));
+
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab.status == test_result::fatal_error);
+        CHECK(ab.trace == test_trace().error_token("ab").error(0, 2, "missing token").cancel());
+        auto abd = LEXY_VERIFY("abdc!");
+        CHECK(abd.status == test_result::fatal_error);
+        CHECK(abd.trace == test_trace().error_token("abd").error(0, 3, "missing token").cancel());
+    }
+    SUBCASE("longest match")
+    {
+        constexpr auto rule = dsl::token_dfa(LEXY_LIT("a") + dsl::while_(LEXY_LIT("bc")));
+
+        constexpr auto callback = token_callback;
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a.status == test_result::success);
+        CHECK(a.trace == test_trace().token("a"));
+        auto abcbc = LEXY_VERIFY("abcbc");
+        CHECK(abcbc.status == test_result::success);
+        CHECK(abcbc.trace == test_trace().token("abcbc"));
+
+        // The DFA backtracks to the last accepting position.
+        auto abcb = LEXY_VERIFY("abcb");
+        CHECK(abcb.status == test_result::success);
+        CHECK(abcb.trace == test_trace().token("abc"));
+    }
+    SUBCASE("choice")
+    {
+        // Unlike dsl::token(), it doesn't commit to the first alternative.
+        constexpr auto rule = dsl::token_dfa(LEXY_LIT("a") | LEXY_LIT("ab"));
+
+        constexpr auto callback = token_callback;
+
+        auto a = LEXY_VERIFY("ac");
+        CHECK(a.status == test_result::success);
+        CHECK(a.trace == test_trace().token("a"));
+        auto ab = LEXY_VERIFY("ab");
+        CHECK(ab.status == test_result::success);
+        CHECK(ab.trace == test_trace().token("ab"));
+    }
+    SUBCASE("identifier")
+    {
+        constexpr auto rule = dsl::token_dfa(
+            dsl::identifier(dsl::ascii::alpha_underscore, dsl::ascii::alpha_digit_underscore));
+
+        constexpr auto callback = token_callback;
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty.status == test_result::fatal_error);
+        CHECK(empty.trace == test_trace().error(0, 0, "missing token").cancel());
+
+        auto a = LEXY_VERIFY("a");
+        CHECK(a.status == test_result::success);
+        CHECK(a.trace == test_trace().token("a"));
+        auto abc123 = LEXY_VERIFY("_abc123+");
+        CHECK(abc123.status == test_result::success);
+        CHECK(abc123.trace == test_trace().token("_abc123"));
+
+        auto digit = LEXY_VERIFY("1abc");
+        CHECK(digit.status == test_result::fatal_error);
+        CHECK(digit.trace == test_trace().error(0, 0, "missing token").cancel());
+    }
+    SUBCASE("number")
+    {
+        constexpr auto rule = dsl::token_dfa(dsl::opt(dsl::lit_c<'-'>) + dsl::digits<>
+                                             + dsl::opt(dsl::lit_c<'.'> >> dsl::digits<>));
+
+        constexpr auto callback = token_callback;
+
+        auto integer = LEXY_VERIFY("-123");
+        CHECK(integer.status == test_result::success);
+        CHECK(integer.trace == test_trace().token("-123"));
+        auto decimal = LEXY_VERIFY("3.14");
+        CHECK(decimal.status == test_result::success);
+        CHECK(decimal.trace == test_trace().token("3.14"));
+        auto dot = LEXY_VERIFY("42.");
+        CHECK(dot.status == test_result::success);
+        CHECK(dot.trace == test_trace().token("42"));
+
+        auto minus = LEXY_VERIFY("-");
+        CHECK(minus.status == test_result::fatal_error);
+        CHECK(minus.trace == test_trace().error_token("-").error(0, 1, "missing token").cancel());
+    }
+    SUBCASE("literal set")
+    {
+        constexpr auto rule = dsl::token_dfa(
+            dsl::literal_set(LEXY_LIT("+"), LEXY_LIT("++"), LEXY_LIT("+="), LEXY_LIT("<<="),
+                             LEXY_LIT("<")));
+
+        constexpr auto callback = token_callback;
+
+        auto plus = LEXY_VERIFY("+-");
+        CHECK(plus.status == test_result::success);
+        CHECK(plus.trace == test_trace().token("+"));
+        auto plus_plus = LEXY_VERIFY("+++");
+        CHECK(plus_plus.status == test_result::success);
+        CHECK(plus_plus.trace == test_trace().token("++"));
+        auto shl = LEXY_VERIFY("<<=");
+        CHECK(shl.status == test_result::success);
+        CHECK(shl.trace == test_trace().token("<<="));
+        auto less = LEXY_VERIFY("<<");
+        CHECK(less.status == test_result::success);
+        CHECK(less.trace == test_trace().token("<"));
+
+        auto minus = LEXY_VERIFY("-");
+        CHECK(minus.status == test_result::fatal_error);
+        CHECK(minus.trace == test_trace().error(0, 0, "missing token").cancel());
+    }
+    SUBCASE("non-ASCII")
+    {
+        constexpr auto rule = dsl::token_dfa(dsl::while_one(dsl::lit_b<0xFF>));
+
+        constexpr auto callback = token_callback;
+
+        auto empty = LEXY_VERIFY(lexy::byte_encoding{});
+        CHECK(empty.status == test_result::fatal_error);
+        CHECK(empty.trace == test_trace().error(0, 0, "missing token").cancel());
+
+        auto ff = LEXY_VERIFY(lexy::byte_encoding{}, 0xFF, 0xFF, 0x00);
+        CHECK(ff.status == test_result::success);
+        CHECK(ff.trace == test_trace().token("\\FF\\FF"));
+    }
+}
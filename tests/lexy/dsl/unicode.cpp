@@ -5,6 +5,7 @@
 
 #include "verify.hpp"
 #include <lexy/dsl/ascii.hpp>
+#include <lexy/input/string_input.hpp>
 
 namespace
 {
@@ -38,6 +39,52 @@ void test(const char* name, Rule rule, AsciiRule arule)
         }
     }
 }
+
+// Checks that the rule matches UTF-8 code units the same way as the decoded code points.
+template <typename Rule>
+void test_utf8(Rule rule)
+{
+    for (auto cp = char32_t(0x80); cp <= 0x10FFFF; ++cp)
+    {
+        LEXY_CHAR8_T input[5] = {};
+        auto size = lexy::_detail::encode_code_point<lexy::utf8_encoding>(cp, input, 4);
+        input[size] = 'a';
+
+        auto reader = lexy::string_input<lexy::utf8_encoding>(input, size + 1).reader();
+        if (lexy::try_match_token(rule, reader))
+        {
+            INFO(cp);
+            CHECK(Rule::char_class_match_cp(cp));
+            CHECK(reader.position() == input + size);
+        }
+        else
+        {
+            INFO(cp);
+            CHECK(!Rule::char_class_match_cp(cp));
+            CHECK(reader.position() == input);
+        }
+    }
+
+    auto invalid = [&](std::initializer_list<unsigned char> bytes) {
+        LEXY_CHAR8_T input[4] = {};
+        auto         size     = std::size_t(0);
+        for (auto byte : bytes)
+            input[size++] = LEXY_CHAR8_T(byte);
+
+        auto reader = lexy::string_input<lexy::utf8_encoding>(input, size).reader();
+        return !lexy::try_match_token(rule, reader) && reader.position() == input;
+    };
+    CHECK(invalid({0xC3}));                   // truncated
+    CHECK(invalid({0xE3, 0x81}));             // truncated
+    CHECK(invalid({0xE3, 0x81, 'a'}));        // truncated
+    CHECK(invalid({0xA4}));                   // continuation
+    CHECK(invalid({0xC1, 0x81}));             // overlong
+    CHECK(invalid({0xE0, 0x81, 0x81}));       // overlong
+    CHECK(invalid({0xF0, 0x81, 0x81, 0x81})); // overlong
+    CHECK(invalid({0xED, 0xA0, 0x80}));       // surrogate
+    CHECK(invalid({0xF4, 0x90, 0x80, 0x80})); // out of range
+    CHECK(invalid({0xF8, 0x81, 0x81, 0x81})); // invalid lead
+}
 } // namespace
 
 TEST_CASE("dsl::unicode::control")
@@ -128,6 +175,7 @@ TEST_CASE("dsl::unicode::alpha")
     CHECK(lexy::is_token_rule<decltype(rule)>);
 
     test("code-point.alphabetic", rule, dsl::ascii::alpha);
+    test_utf8(rule);
 }
 
 TEST_CASE("dsl::unicode::alpha_digit")
@@ -188,6 +236,7 @@ TEST_CASE("dsl::unicode::xid_start")
     CHECK(lexy::is_token_rule<decltype(rule)>);
 
     test("code-point.XID-start", rule, dsl::ascii::alpha);
+    test_utf8(rule);
 }
 
 TEST_CASE("dsl::unicode::xid_start_underscore")
@@ -196,6 +245,7 @@ TEST_CASE("dsl::unicode::xid_start_underscore")
     CHECK(lexy::is_token_rule<decltype(rule)>);
 
     test("code-point.XID-start-underscore", rule, dsl::ascii::alpha_underscore);
+    test_utf8(rule);
 }
 
 TEST_CASE("dsl::unicode::xid_continue")
@@ -204,5 +254,6 @@ TEST_CASE("dsl::unicode::xid_continue")
     CHECK(lexy::is_token_rule<decltype(rule)>);
 
     test("code-point.XID-continue", rule, dsl::ascii::alpha_digit_underscore);
+    test_utf8(rule);
 }
 
@@ -61,6 +61,9 @@ TEST_CASE("dsl::until()")
         auto many = LEXY_VERIFY(lexy::utf8_char_encoding{}, "abcdefghijklmnopqrstuvwxyz\n");
         CHECK(many.status == test_result::success);
         CHECK(many.trace == test_trace().token("any", "abcdefghijklmnopqrstuvwxyz\\n"));
+        auto many_utf16 = LEXY_VERIFY(u"abcdefghijklmnopqrstuvwxyz\n");
+        CHECK(many_utf16.status == test_result::success);
+        CHECK(many_utf16.trace == test_trace().token("any", "abcdefghijklmnopqrstuvwxyz\\n"));
 
         auto partial_before
             = LEXY_VERIFY(lexy::utf8_char_encoding{}, "abcdefghijklmno\rpqrstuvwxyz\n");
@@ -132,6 +135,9 @@ TEST_CASE("dsl::until().or_eof()")
         auto many = LEXY_VERIFY(lexy::utf8_char_encoding{}, "abcdefghijklmnopqrstuvwxyz\n");
         CHECK(many.status == test_result::success);
         CHECK(many.trace == test_trace().token("any", "abcdefghijklmnopqrstuvwxyz\\n"));
+        auto many_utf16 = LEXY_VERIFY(u"abcdefghijklmnopqrstuvwxyz\n");
+        CHECK(many_utf16.status == test_result::success);
+        CHECK(many_utf16.trace == test_trace().token("any", "abcdefghijklmnopqrstuvwxyz\\n"));
 
         auto partial_before
             = LEXY_VERIFY(lexy::utf8_char_encoding{}, "abcdefghijklmno\rpqrstuvwxyz\n");
@@ -184,6 +184,9 @@ TEST_CASE("dsl::whitespace")
         auto swar = LEXY_VERIFY(lexy::utf8_char_encoding{}, "-------------");
         CHECK(swar.status == test_result::success);
         CHECK(swar.trace == test_trace().whitespace("-------------"));
+        auto swar_utf16 = LEXY_VERIFY(u"-------------");
+        CHECK(swar_utf16.status == test_result::success);
+        CHECK(swar_utf16.trace == test_trace().whitespace("-------------"));
 
         struct production : test_production_for<decltype(rule)>, with_whitespace
         {};
@@ -275,6 +278,64 @@ TEST_CASE("dsl::whitespace")
         CHECK(trailing_whitespace.status == test_result::success);
         CHECK(trailing_whitespace.trace == test_trace().whitespace("abc"));
     }
+    SUBCASE("char class")
+    {
+        constexpr auto rule = dsl::whitespace(dsl::lit_c<'-'> / dsl::lit_c<'+'>);
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty.status == test_result::success);
+        CHECK(empty.trace == test_trace());
+
+        auto one = LEXY_VERIFY("-");
+        CHECK(one.status == test_result::success);
+        CHECK(one.trace == test_trace().whitespace("-"));
+        auto mixed = LEXY_VERIFY("-+--");
+        CHECK(mixed.status == test_result::success);
+        CHECK(mixed.trace == test_trace().whitespace("-+--"));
+
+        auto swar = LEXY_VERIFY(lexy::utf8_char_encoding{}, "--+-------+-----+--");
+        CHECK(swar.status == test_result::success);
+        CHECK(swar.trace == test_trace().whitespace("--+-------+-----+--"));
+        auto swar_partial = LEXY_VERIFY(lexy::utf8_char_encoding{}, "-----------abc");
+        CHECK(swar_partial.status == test_result::success);
+        CHECK(swar_partial.trace == test_trace().whitespace("-----------"));
+        auto swar_utf16 = LEXY_VERIFY(u"--+-------+-----+--");
+        CHECK(swar_utf16.status == test_result::success);
+        CHECK(swar_utf16.trace == test_trace().whitespace("--+-------+-----+--"));
+        auto swar_utf16_partial = LEXY_VERIFY(u"-----------abc");
+        CHECK(swar_utf16_partial.status == test_result::success);
+        CHECK(swar_utf16_partial.trace == test_trace().whitespace("-----------"));
+    }
+    SUBCASE("char class | branch")
+    {
+        constexpr auto rule
+            = dsl::whitespace(dsl::lit_c<'-'> / dsl::lit_c<'+'> | LEXY_LIT("#") >> LEXY_LIT("c"));
+        CHECK(lexy::is_rule<decltype(rule)>);
+
+        auto empty = LEXY_VERIFY("");
+        CHECK(empty.status == test_result::success);
+        CHECK(empty.trace == test_trace());
+
+        auto char_class = LEXY_VERIFY("-+-");
+        CHECK(char_class.status == test_result::success);
+        CHECK(char_class.trace == test_trace().whitespace("-+-"));
+        auto branch = LEXY_VERIFY("#c");
+        CHECK(branch.status == test_result::success);
+        CHECK(branch.trace == test_trace().whitespace("#c"));
+        auto mixed = LEXY_VERIFY("-#c#c--#c+");
+        CHECK(mixed.status == test_result::success);
+        CHECK(mixed.trace == test_trace().whitespace("-#c#c--#c+"));
+
+        auto swar = LEXY_VERIFY(lexy::utf8_char_encoding{}, "----------#c----------#c---------abc");
+        CHECK(swar.status == test_result::success);
+        CHECK(swar.trace == test_trace().whitespace("----------#c----------#c---------"));
+
+        auto ws_failure = LEXY_VERIFY("--#d");
+        CHECK(ws_failure.status == test_result::fatal_error);
+        CHECK(ws_failure.trace
+              == test_trace().expected_literal(3, "c", 0).error_token("--#").cancel());
+    }
 
     SUBCASE("operator|")
     {
@@ -23,3 +23,20 @@ TEST_CASE("partial_input()")
     CHECK(partial.peek() == lexy::default_encoding::eof());
 }
 
+
+TEST_CASE("_rr::remaining() and _rr::advance()")
+{
+    auto input  = lexy::zstring_input("abcd");
+    auto reader = input.reader();
+    CHECK(lexy::_detail::is_bulk_reader<decltype(reader)>);
+    CHECK(reader.remaining() == 4);
+
+    reader.advance(3);
+    CHECK(reader.position() == input.data() + 3);
+    CHECK(reader.remaining() == 1);
+    CHECK(reader.peek() == 'd');
+
+    reader.advance(1);
+    CHECK(reader.remaining() == 0);
+    CHECK(reader.peek() == lexy::default_encoding::eof());
+}
@@ -6,6 +6,7 @@
 #include <doctest/doctest.h>
 #include <lexy/input/argv_input.hpp>
 #include <lexy/input/string_input.hpp>
+#include <vector>
 
 #if defined(__has_include) && __has_include(<memory_resource>) && !defined(_LIBCPP_VERSION)
 #    include <memory_resource>
@@ -461,6 +462,150 @@ TEST_CASE("make_buffer_from_raw")
     }
 }
 
+TEST_CASE("make_buffer_transcoded")
+{
+    SUBCASE("utf8 to utf16")
+    {
+        // A block of ASCII, then ä, 🙂, and a trailing ASCII character.
+        const unsigned char str[]
+            = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0xC3, 0xA4, 0xF0, 0x9F, 0x99, 0x82, 'i'};
+
+        auto result = lexy::make_buffer_transcoded<lexy::utf8_encoding,
+                                                   lexy::utf16_encoding>(str, sizeof(str));
+        CHECK(result);
+        CHECK(result.error_count() == 0);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 12);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[7] == 'h');
+        CHECK(buffer.data()[8] == 0xE4);
+        CHECK(buffer.data()[9] == 0xD83D);
+        CHECK(buffer.data()[10] == 0xDE42);
+        CHECK(buffer.data()[11] == 'i');
+    }
+    SUBCASE("utf8 with BOM")
+    {
+        const unsigned char str[] = {0xEF, 0xBB, 0xBF, 'a', 'b', 'c'};
+
+        auto result = lexy::make_buffer_transcoded<lexy::utf8_encoding,
+                                                   lexy::utf8_encoding>(str, sizeof(str));
+        CHECK(result);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 3);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 'b');
+        CHECK(buffer.data()[2] == 'c');
+        // The buffer still has the EOF sentinel.
+        CHECK(buffer.data()[3] == lexy::utf8_encoding::eof());
+    }
+    SUBCASE("utf16 to utf8")
+    {
+        // Little endian with BOM: 8 ASCII characters, ä, 🙂.
+        const unsigned char str[]
+            = {0xFF, 0xFE, 'a', 0, 'b', 0, 'c', 0,    'd',  0,    'e',  0,   'f',
+               0,    'g',  0,   'h', 0, 0xE4, 0x00, 0x3D, 0xD8, 0x42, 0xDE};
+
+        auto result = lexy::make_buffer_transcoded<lexy::utf16_encoding,
+                                                   lexy::utf8_encoding>(str, sizeof(str));
+        CHECK(result);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 14);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[7] == 'h');
+        CHECK(buffer.data()[8] == 0xC3);
+        CHECK(buffer.data()[9] == 0xA4);
+        CHECK(buffer.data()[10] == 0xF0);
+        CHECK(buffer.data()[11] == 0x9F);
+        CHECK(buffer.data()[12] == 0x99);
+        CHECK(buffer.data()[13] == 0x82);
+
+        auto big = lexy::make_buffer_transcoded<lexy::utf16_encoding, lexy::utf8_encoding,
+                                                lexy::encoding_endianness::big>(str + 2, 4);
+        CHECK(big);
+        REQUIRE(big.buffer().size() == 6);
+        CHECK(big.buffer().data()[0] == 0xE6);
+        CHECK(big.buffer().data()[1] == 0x84);
+        CHECK(big.buffer().data()[2] == 0x80);
+    }
+    SUBCASE("latin1 to utf8")
+    {
+        const unsigned char str[] = {'a', 0xE4, 0xFF};
+
+        auto result = lexy::make_buffer_transcoded<lexy::byte_encoding,
+                                                   lexy::utf8_encoding>(str, sizeof(str));
+        CHECK(result);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 5);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xC3);
+        CHECK(buffer.data()[2] == 0xA4);
+        CHECK(buffer.data()[3] == 0xC3);
+        CHECK(buffer.data()[4] == 0xBF);
+    }
+    SUBCASE("utf32 to utf16")
+    {
+        const unsigned char str[] = {0x00, 0x00, 0x00, 'a', 0x00, 0x01, 0xF6, 0x42};
+
+        auto result = lexy::make_buffer_transcoded<lexy::utf32_encoding,
+                                                   lexy::utf16_encoding>(str, sizeof(str));
+        CHECK(result);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 3);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xD83D);
+        CHECK(buffer.data()[2] == 0xDE42);
+    }
+    SUBCASE("invalid input")
+    {
+        // Trailing byte, FF, truncated sequence, surrogate, and truncated sequence at EOF.
+        const unsigned char str[]
+            = {'a', 0x80, 'b', 0xFF, 'c', 0xC3, 'd', 0xED, 0xA0, 0x80, 'e', 0xE2, 0x82};
+
+        std::vector<std::size_t> errors;
+        auto result = lexy::make_buffer_transcoded<lexy::utf8_encoding, lexy::utf16_encoding>(
+            str, sizeof(str), [&](std::size_t offset) { errors.push_back(offset); });
+        CHECK(!result);
+        CHECK(result.error_count() == 5);
+        CHECK(result.first_error() == 1);
+        CHECK(errors == std::vector<std::size_t>{1, 3, 5, 7, 11});
+
+        auto buffer = LEXY_MOV(result).buffer();
+        REQUIRE(buffer.size() == 10);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xFFFD);
+        CHECK(buffer.data()[2] == 'b');
+        CHECK(buffer.data()[3] == 0xFFFD);
+        CHECK(buffer.data()[4] == 'c');
+        CHECK(buffer.data()[5] == 0xFFFD);
+        CHECK(buffer.data()[6] == 'd');
+        CHECK(buffer.data()[7] == 0xFFFD);
+        CHECK(buffer.data()[8] == 'e');
+        CHECK(buffer.data()[9] == 0xFFFD);
+    }
+    SUBCASE("incomplete code unit")
+    {
+        const unsigned char str[] = {0x00, 'a', 0x00};
+
+        auto result = lexy::make_buffer_transcoded<lexy::utf16_encoding,
+                                                   lexy::utf8_encoding>(str, sizeof(str));
+        CHECK(!result);
+        CHECK(result.error_count() == 1);
+        CHECK(result.first_error() == 2);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 4);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xEF);
+        CHECK(buffer.data()[2] == 0xBF);
+        CHECK(buffer.data()[3] == 0xBD);
+    }
+}
+
 TEST_CASE("make_buffer_from_input")
 {
     SUBCASE("input with data/size")
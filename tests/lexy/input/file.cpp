@@ -24,6 +24,12 @@ void write_test_data(const char* data)
     std::fputs(data, file);
     std::fclose(file);
 }
+void write_test_data(const void* data, std::size_t size)
+{
+    auto file = std::fopen(test_file_name, "wb");
+    std::fwrite(data, 1, size, file);
+    std::fclose(file);
+}
 } // namespace
 
 TEST_CASE("read_file")
@@ -195,6 +201,134 @@ TEST_CASE("read_file")
     std::remove(test_file_name);
 }
 
+TEST_CASE("read_file_auto")
+{
+    std::remove(test_file_name);
+
+    SUBCASE("non-existing file")
+    {
+        auto result = lexy::read_file_auto(test_file_name);
+        CHECK(!result);
+        CHECK(result.error() == lexy::file_error::file_not_found);
+    }
+    SUBCASE("empty file")
+    {
+        write_test_data("");
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf8);
+        CHECK(result.transcode_error_count() == 0);
+        CHECK(result.buffer().size() == 0);
+    }
+    SUBCASE("UTF-8")
+    {
+        write_test_data("abc\xC3\xA4");
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf8);
+        CHECK(result.transcode_error_count() == 0);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 5);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[3] == 0xC3);
+        CHECK(buffer.data()[4] == 0xA4);
+    }
+    SUBCASE("UTF-8 with BOM")
+    {
+        write_test_data("\xEF\xBB\xBF"
+                        "abc");
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf8);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 3);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 'b');
+        CHECK(buffer.data()[2] == 'c');
+    }
+    SUBCASE("invalid UTF-8")
+    {
+        write_test_data("\xEF\xBB\xBF"
+                        "a\x80");
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf8);
+        CHECK(result.transcode_error_count() == 1);
+        CHECK(result.first_transcode_error() == 4);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 4);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xEF);
+        CHECK(buffer.data()[2] == 0xBF);
+        CHECK(buffer.data()[3] == 0xBD);
+    }
+    SUBCASE("UTF-16 with BOM")
+    {
+        const unsigned char data[] = {0xFF, 0xFE, 'a', 0x00, 0xE4, 0x00};
+        write_test_data(data, sizeof(data));
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf16_little);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 3);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xC3);
+        CHECK(buffer.data()[2] == 0xA4);
+    }
+    SUBCASE("UTF-16 without BOM")
+    {
+        const unsigned char data[] = {0x00, 'a', 0x00, 0xE4};
+        write_test_data(data, sizeof(data));
+
+        auto result = lexy::read_file_auto<lexy::utf16_encoding>(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf16_big);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 2);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 0xE4);
+    }
+    SUBCASE("UTF-32 with BOM")
+    {
+        const unsigned char data[] = {0x00, 0x00, 0xFE, 0xFF, 0x00, 0x01, 0xF6, 0x42};
+        write_test_data(data, sizeof(data));
+
+        auto result = lexy::read_file_auto<lexy::utf32_encoding>(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf32_big);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 1);
+        CHECK(buffer.data()[0] == 0x1F642);
+    }
+    SUBCASE("UTF-32 without BOM")
+    {
+        const unsigned char data[] = {'a', 0x00, 0x00, 0x00, 'b', 0x00, 0x00, 0x00};
+        write_test_data(data, sizeof(data));
+
+        auto result = lexy::read_file_auto(test_file_name);
+        REQUIRE(result);
+        CHECK(result.source_encoding() == lexy::file_encoding::utf32_little);
+
+        auto& buffer = result.buffer();
+        REQUIRE(buffer.size() == 2);
+        CHECK(buffer.data()[0] == 'a');
+        CHECK(buffer.data()[1] == 'b');
+    }
+
+    std::remove(test_file_name);
+}
+
 TEST_CASE("read_stdin")
 {
     // Here, we'll reassociate stdin with our test file.
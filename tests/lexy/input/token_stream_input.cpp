@@ -0,0 +1,222 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy/input/token_stream_input.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/action/parse_as_tree.hpp>
+#include <lexy/dsl/ascii.hpp>
+#include <lexy/dsl/choice.hpp>
+#include <lexy/dsl/eof.hpp>
+#include <lexy/dsl/list.hpp>
+#include <lexy/dsl/literal.hpp>
+#include <lexy/dsl/option.hpp>
+#include <lexy/dsl/parse_tree_node.hpp>
+#include <lexy/dsl/production.hpp>
+#include <lexy/dsl/sequence.hpp>
+#include <lexy/dsl/terminator.hpp>
+#include <lexy/dsl/token.hpp>
+#include <lexy/dsl/whitespace.hpp>
+#include <lexy/input/string_input.hpp>
+#include <lexy/visualize.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+enum class token_kind
+{
+    lparen,
+    rparen,
+    word,
+};
+
+using token = lexy::token_for<lexy::string_input<>, token_kind>;
+
+// A hand-written lexer that is a stand-in for a separate lexing pass.
+std::vector<token> lex(lexy::string_input<> input)
+{
+    std::vector<token> result;
+
+    auto cur = input.data();
+    auto end = input.data() + input.size();
+    while (cur != end)
+    {
+        auto begin = cur;
+        if (*cur == '(')
+            result.emplace_back(token_kind::lparen, begin, ++cur);
+        else if (*cur == ')')
+            result.emplace_back(token_kind::rparen, begin, ++cur);
+        else if (*cur == ' ')
+        {
+            while (cur != end && *cur == ' ')
+                ++cur;
+            result.emplace_back(lexy::whitespace_token_kind, begin, cur);
+        }
+        else
+        {
+            while (cur != end && *cur != '(' && *cur != ')' && *cur != ' ')
+                ++cur;
+            result.emplace_back(token_kind::word, begin, cur);
+        }
+    }
+
+    return result;
+}
+
+namespace text_grammar
+{
+    namespace dsl = lexy::dsl;
+
+    struct list;
+
+    struct item : lexy::transparent_production
+    {
+        static constexpr auto rule
+            = dsl::recurse_branch<list>
+              | dsl::else_ >> dsl::token(dsl::while_one(dsl::ascii::alnum)).kind<token_kind::word>;
+    };
+
+    struct list
+    {
+        static constexpr auto name = "list";
+        static constexpr auto rule
+            = dsl::lit_c<'('>.kind<token_kind::lparen> //
+              >> dsl::terminator(dsl::lit_c<')'>.kind<token_kind::rparen>).opt_list(dsl::p<item>);
+    };
+
+    struct document
+    {
+        static constexpr auto name       = "document";
+        static constexpr auto whitespace = dsl::lit_c<' '>;
+        static constexpr auto rule       = dsl::p<list> + dsl::eof;
+    };
+} // namespace text_grammar
+
+namespace token_grammar
+{
+    namespace dsl = lexy::dsl;
+
+    struct list;
+
+    struct item : lexy::transparent_production
+    {
+        static constexpr auto rule
+            = dsl::recurse_branch<list> | dsl::else_ >> dsl::tnode<token_kind::word>;
+    };
+
+    struct list
+    {
+        static constexpr auto name = "list";
+        static constexpr auto rule
+            = dsl::tnode<token_kind::lparen> //
+              >> dsl::terminator(dsl::tnode<token_kind::rparen>).opt_list(dsl::p<item>);
+    };
+
+    struct document
+    {
+        static constexpr auto name       = "document";
+        static constexpr auto whitespace = dsl::tnode<lexy::whitespace_token_kind>;
+        static constexpr auto rule       = dsl::p<list> + dsl::eof;
+    };
+} // namespace token_grammar
+} // namespace
+
+TEST_CASE("token_stream_input")
+{
+    auto input  = lexy::zstring_input("(ab c)");
+    auto tokens = lex(input);
+    REQUIRE(tokens.size() == 5);
+
+    lexy::token_stream_input token_input(tokens);
+    CHECK(token_input.data() == tokens.data());
+    CHECK(token_input.size() == tokens.size());
+
+    auto reader = token_input.reader();
+    CHECK(reader.position() == input.data());
+    CHECK(reader.peek() == tokens.data());
+    CHECK(lexy::token_stream_encoding<token>::match(reader.peek(), token_kind::lparen));
+
+    reader.bump();
+    CHECK(reader.position() == input.data() + 1);
+    CHECK(reader.peek()->kind() == token_kind::word);
+    {
+        auto lexeme_reader = reader.lexeme_reader();
+        CHECK(lexeme_reader.position() == input.data() + 1);
+        CHECK(lexeme_reader.peek() == 'a');
+    }
+
+    auto marker = reader.current();
+    reader.bump();
+    reader.bump();
+    reader.bump();
+    CHECK(reader.position() == input.data() + 5);
+    CHECK(reader.peek()->kind() == token_kind::rparen);
+
+    reader.bump();
+    CHECK(reader.position() == input.data() + 6);
+    CHECK(reader.peek() == lexy::token_stream_encoding<token>::eof());
+    CHECK(!lexy::token_stream_encoding<token>::match(reader.peek(), token_kind::rparen));
+
+    reader.reset(marker);
+    CHECK(reader.position() == input.data() + 1);
+    CHECK(reader.peek()->kind() == token_kind::word);
+}
+
+TEST_CASE("token_stream_input empty")
+{
+    auto input = lexy::token_stream_input<token>();
+    CHECK(input.size() == 0);
+
+    auto reader = input.reader();
+    CHECK(reader.peek() == lexy::token_stream_encoding<token>::eof());
+}
+
+TEST_CASE("parse_as_tree with token_stream_input")
+{
+    auto to_string = [](const auto& tree) {
+        std::string result;
+        lexy::visualize_to(std::back_inserter(result), tree);
+        return result;
+    };
+
+    auto parse = [&](const char* str) {
+        auto input = lexy::zstring_input(str);
+
+        lexy::parse_tree_for<decltype(input), token_kind> text_tree;
+        auto text_result = lexy::parse_as_tree<text_grammar::document>(text_tree, input, lexy::noop);
+        REQUIRE(text_result);
+
+        auto                                                    tokens = lex(input);
+        lexy::token_stream_input                                token_input(tokens);
+        lexy::parse_tree_for<decltype(token_input), token_kind> token_tree;
+        auto token_result
+            = lexy::parse_as_tree<token_grammar::document>(token_tree, token_input, lexy::noop);
+        REQUIRE(token_result);
+
+        CHECK(to_string(text_tree) == to_string(token_tree));
+        return token_tree;
+    };
+
+    SUBCASE("flat")
+    {
+        auto tree = parse("(a b c)");
+        CHECK(tree.size() == 2 + 8);
+    }
+    SUBCASE("nested")
+    {
+        auto tree = parse("(a (b  c) (d) ((e)))");
+        CHECK(!tree.empty());
+    }
+    SUBCASE("error")
+    {
+        auto                                                    input  = lexy::zstring_input("(a b");
+        auto                                                    tokens = lex(input);
+        lexy::token_stream_input                                token_input(tokens);
+        lexy::parse_tree_for<decltype(token_input), token_kind> token_tree;
+        auto result
+            = lexy::parse_as_tree<token_grammar::document>(token_tree, token_input, lexy::noop);
+        CHECK(!result);
+        CHECK(result.error_count() == 1);
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy_ext/intern_table.hpp>
+
+#include <doctest/doctest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("sharded_intern_table")
+{
+    lexy_ext::sharded_intern_table<char> table;
+    CHECK(table.size() == 0);
+
+    auto abc = table.intern("abc", 3);
+    CHECK(abc.c_str() == std::string("abc"));
+    CHECK(table.intern("abc", 3) == abc);
+    CHECK(table.intern("ab", 2) != abc);
+    CHECK(table.size() == 2);
+
+    SUBCASE("concurrent")
+    {
+        constexpr auto thread_count = 4;
+        constexpr auto string_count = 500;
+
+        std::vector<std::vector<lexy::interned_string<char>>> results(thread_count);
+        std::vector<std::thread>                              threads;
+        for (auto t = 0; t != thread_count; ++t)
+            threads.emplace_back([&, t] {
+                // Each thread interns the same strings in a different order.
+                for (auto i = 0; i != string_count; ++i)
+                {
+                    auto str = std::to_string((i * (t + 1)) % string_count);
+                    results[std::size_t(t)].push_back(table.intern(str.data(), str.size()));
+                }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(table.size() == 2 + string_count);
+        for (auto t = 0; t != thread_count; ++t)
+            for (auto i = 0; i != string_count; ++i)
+            {
+                auto str = std::to_string((i * (t + 1)) % string_count);
+                CHECK(table.intern(str.data(), str.size())
+                      == results[std::size_t(t)][std::size_t(i)]);
+            }
+        CHECK(table.size() == 2 + string_count);
+    }
+}
@@ -0,0 +1,185 @@
+// Copyright (C) 2020-2025 Jonathan Müller and lexy contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <lexy_ext/parallel_visit.hpp>
+
+#include <doctest/doctest.h>
+#include <lexy/input/string_input.hpp>
+
+namespace
+{
+enum class token_kind
+{
+    a,
+    b,
+    c,
+};
+
+struct child_p
+{
+    static constexpr auto rule = 0; // Need a rule to identify as production.
+};
+
+struct nested_p
+{
+    static constexpr auto rule = 0; // Need a rule to identify as production.
+};
+
+struct root_p
+{
+    static constexpr auto rule = 0; // Need a rule to identify as production.
+};
+} // namespace
+
+TEST_CASE("parallel_visit()")
+{
+    using parse_tree = lexy::parse_tree_for<lexy::string_input<>, token_kind>;
+    auto input       = lexy::zstring_input("1(ab)2(cc(a))3");
+
+    auto tree = [&] {
+        parse_tree::builder builder(root_p{});
+        builder.token(token_kind::a, input.data(), input.data() + 1);
+
+        auto child = builder.start_production(child_p{});
+        builder.token(token_kind::b, input.data() + 1, input.data() + 2);
+        builder.token(token_kind::c, input.data() + 2, input.data() + 4);
+        builder.token(token_kind::b, input.data() + 4, input.data() + 5);
+        builder.finish_production(LEXY_MOV(child));
+
+        builder.token(token_kind::a, input.data() + 5, input.data() + 6);
+
+        child = builder.start_production(child_p{});
+        builder.token(token_kind::b, input.data() + 6, input.data() + 7);
+        builder.token(token_kind::c, input.data() + 7, input.data() + 9);
+        {
+            auto nested = builder.start_production(nested_p{});
+            auto inner  = builder.start_production(child_p{});
+            builder.token(token_kind::b, input.data() + 9, input.data() + 10);
+            builder.token(token_kind::c, input.data() + 10, input.data() + 11);
+            builder.token(token_kind::b, input.data() + 11, input.data() + 12);
+            builder.finish_production(LEXY_MOV(inner));
+            builder.finish_production(LEXY_MOV(nested));
+        }
+        builder.token(token_kind::b, input.data() + 12, input.data() + 13);
+        builder.finish_production(LEXY_MOV(child));
+
+        builder.token(token_kind::a, input.data() + 13, input.data() + 14);
+
+        return LEXY_MOV(builder).finish(input.data() + 14);
+    }();
+
+    SUBCASE("production")
+    {
+        std::atomic<std::size_t> count(0);
+        std::atomic<std::size_t> size(0);
+
+        auto partitions = lexy_ext::parallel_visit(
+            tree, child_p{},
+            [&](parse_tree::node node) {
+                ++count;
+                size += node.covering_lexeme().size();
+            },
+            lexy_ext::thread_executor(4));
+        // The nested child_p is part of the second partition.
+        CHECK(partitions == 2);
+        CHECK(count == 2);
+        CHECK(size == 4 + 7);
+    }
+    SUBCASE("token kind")
+    {
+        std::atomic<std::size_t> count(0);
+
+        auto partitions = lexy_ext::parallel_visit(
+            tree, token_kind::a, [&](parse_tree::node node) { count += node.lexeme().size(); },
+            lexy_ext::sequential_executor{});
+        CHECK(partitions == 3);
+        CHECK(count == 3);
+    }
+    SUBCASE("predicate")
+    {
+        std::atomic<std::size_t> count(0);
+
+        auto partitions = lexy_ext::parallel_visit(
+            tree, [](parse_tree::node node) { return node.kind() == nested_p{}; },
+            [&](parse_tree::node) { ++count; });
+        CHECK(partitions == 1);
+        CHECK(count == 1);
+    }
+    SUBCASE("root")
+    {
+        std::atomic<std::size_t> count(0);
+
+        auto partitions = lexy_ext::parallel_visit(
+            tree, root_p{}, [&](parse_tree::node node) { count += node.kind().is_root() ? 1 : 0; },
+            lexy_ext::thread_executor(4));
+        CHECK(partitions == 1);
+        CHECK(count == 1);
+    }
+    SUBCASE("empty tree")
+    {
+        auto partitions = lexy_ext::parallel_visit(
+            parse_tree(), root_p{}, [&](parse_tree::node) { CHECK(false); },
+            lexy_ext::thread_executor(4));
+        CHECK(partitions == 0);
+    }
+    SUBCASE("deep tree")
+    {
+        auto deep_input = lexy::zstring_input("a");
+
+        parse_tree::builder builder(root_p{});
+        std::vector<parse_tree::builder::marker> markers;
+        for (auto i = 0; i != 100000; ++i)
+            markers.push_back(builder.start_production(nested_p{}));
+        builder.token(token_kind::a, deep_input.data(), deep_input.data() + 1);
+        while (!markers.empty())
+        {
+            builder.finish_production(LEXY_MOV(markers.back()));
+            markers.pop_back();
+        }
+        auto deep_tree = LEXY_MOV(builder).finish(deep_input.data() + 1);
+
+        std::atomic<std::size_t> count(0);
+
+        auto partitions = lexy_ext::parallel_visit(
+            deep_tree, token_kind::a, [&](parse_tree::node) { ++count; },
+            lexy_ext::thread_executor(4));
+        CHECK(partitions == 1);
+        CHECK(count == 1);
+    }
+}
+
+TEST_CASE("thread_executor")
+{
+    std::vector<std::atomic<int>> calls(100);
+    for (auto& c : calls)
+        c = 0;
+
+    lexy_ext::thread_executor executor(3);
+    CHECK(executor.thread_count() == 3);
+
+    executor(calls.size(), [&](std::size_t idx) { ++calls[idx]; });
+    for (auto& c : calls)
+        CHECK(c == 1);
+
+    // No tasks at all.
+    executor(0, [&](std::size_t) { CHECK(false); });
+
+    // Exceptions are rethrown after all threads are joined.
+    std::atomic<int> finished(0);
+    auto             thrown = false;
+    try
+    {
+        executor(calls.size(), [&](std::size_t idx) {
+            if (idx == 42)
+                throw idx;
+            ++finished;
+        });
+    }
+    catch (std::size_t idx)
+    {
+        thrown = true;
+        CHECK(idx == 42);
+    }
+    CHECK(thrown);
+    CHECK(finished < 100);
+}